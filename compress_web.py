@@ -0,0 +1,97 @@
+import gzip
+import os
+import re
+import shutil
+import zlib
+Import("env")
+
+# Web-Content of data/ that is stored gzip-compressed in the Filesystem-Image, serveStatic sends the .gz
+# The .htm-Files are Templates of the Server and the .json-Files are read by the Firmware, both stay plain
+COMPRESS = (".js", ".css", ".svg")
+
+# Framework-Pages as Deflate-Blocks in PROGMEM, the Placeholders of the Table are the same for every Request
+SOURCES = ["lib/JCA_IOT/JCA_IOT_Server/JCA_IOT_Server_WebSites.h", "lib/JCA_IOT/JCA_IOT_Server/JCA_IOT_Server_WebSVGs.h"]
+STATIC = {"SVG_LOGO": "SvgLogo", "SVG_HOME": "SvgHome", "SVG_CONFIG": "SvgConfig", "SVG_WIFI": "SvgWiFi", "SVG_SYSTEM": "SvgSystem"}
+PAGES = {
+  "WebGzSys": dict(STATIC, NAME="NameSys", STYLE="StyleSys", SECTION="SectionSys"),
+  "WebGzConnect": dict(STATIC, NAME="NameConnect", STYLE="StyleConnect", SECTION="SectionConnect"),
+}
+
+def write_if_changed(path, data):
+  if os.path.isfile(path):
+    with open(path, "rb") as f:
+      if f.read() == data:
+        return
+  with open(path, "wb") as f:
+    f.write(data)
+
+def compress_data(source, target):
+  created = set()
+  for root, dirs, files in os.walk(source):
+    folder = os.path.join(target, os.path.relpath(root, source))
+    os.makedirs(folder, exist_ok=True)
+    for name in files:
+      path = os.path.join(root, name)
+      if name.endswith(COMPRESS):
+        output = os.path.join(folder, name + ".gz")
+        with open(path, "rb") as f:
+          write_if_changed(output, gzip.compress(f.read(), 9, mtime=0))
+      else:
+        output = os.path.join(folder, name)
+        shutil.copy2(path, output)
+      created.add(os.path.normpath(output))
+  # Files removed from data/ must not stay in the Image
+  for root, dirs, files in os.walk(target):
+    for name in files:
+      if os.path.normpath(os.path.join(root, name)) not in created:
+        os.remove(os.path.join(root, name))
+
+def read_literals():
+  literals = {}
+  for path in SOURCES:
+    with open(os.path.join(env.subst("$PROJECT_DIR"), path), encoding="utf-8") as f:
+      for name, text in re.findall(r'const char (\w+)\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";', f.read(), re.S):
+        literals[name] = text
+  return literals
+
+def expand(text, table, literals):
+  return re.sub(r"%(\w+)%", lambda m: expand(literals[table[m.group(1)]], table, literals) if m.group(1) in table else m.group(0), text)
+
+def page_segments(name, table, literals):
+  # Every Segment is a byte-aligned Stream of Deflate-Blocks without History, so the Values of the Placeholders
+  # can be put in between as stored Blocks. The CRC of the whole Page is combined by the Server.
+  parts = re.split(r"%(\w+)%", expand(literals["PageFrame"], table, literals))
+  deflate = zlib.compressobj(9, zlib.DEFLATED, -15)
+  lines = []
+  segments = []
+  for i in range(0, len(parts), 2):
+    text = parts[i].encode("utf-8")
+    data = deflate.compress(text) + deflate.flush(zlib.Z_FULL_FLUSH) if text else b""
+    block = "nullptr"
+    if data:
+      block = "%s%d" % (name, i // 2)
+      lines.append("const uint8_t %s[] PROGMEM = {%s};" % (block, ",".join("0x%02x" % b for b in data)))
+    placeholder = '"%s"' % parts[i + 1] if i + 1 < len(parts) else "nullptr"
+    segments.append("  {%s, %d, %d, 0x%08xUL, %s}," % (block, len(data), len(text), zlib.crc32(text), placeholder))
+  lines.append("const WebGzSegment_T %sSegments[] = {" % name)
+  lines.extend(segments)
+  lines.append("};")
+  lines.append("const WebGzPage_T %s = {%sSegments, %d};" % (name, name, len(segments)))
+  return lines
+
+def create_pages(target):
+  literals = read_literals()
+  lines = ["// Generated by compress_web.py from JCA_IOT_Server_WebSites.h, do not edit", "#ifndef _JCA_IOT_SERVER_WEBGZ_", "#define _JCA_IOT_SERVER_WEBGZ_"]
+  for name, table in PAGES.items():
+    lines.extend(page_segments(name, table, literals))
+  lines.append("#endif")
+  os.makedirs(target, exist_ok=True)
+  write_if_changed(os.path.join(target, "JCA_IOT_Server_WebGz.h"), ("\n".join(lines) + "\n").encode("utf-8"))
+
+data_dir = os.path.join(env.subst("$BUILD_DIR"), "data")
+compress_data(env.subst("$PROJECT_DATA_DIR"), data_dir)
+env.Replace(PROJECT_DATA_DIR=data_dir)
+
+page_dir = os.path.join(env.subst("$BUILD_DIR"), "webgz")
+create_pages(page_dir)
+env.Append(CPPPATH=[page_dir])
@@ -65,8 +65,8 @@
 
             // Create Tag-List
             String NumStr = String (i + 1);
-            Tags.push_back (new TagInt32 ("Delay" + NumStr, "Verzögerung " + NumStr, "", true, TagUsage_T::UseConfig, &(Triggers->Pairs[i].Delay), "us"));
-            Tags.push_back (new TagUInt8 ("Value" + NumStr, "Wert " + NumStr, "", false, TagUsage_T::UseData, &(Values[i]), "%", std::bind (&AcDimmers::calc, this)));
+            Tags.push_back (new TagInt32 (JCA::SYS::StringPool::intern ("Delay" + NumStr), JCA::SYS::StringPool::intern ("Verzögerung " + NumStr), "", true, TagUsage_T::UseConfig, &(Triggers->Pairs[i].Delay), "us"));
+            Tags.push_back ((new TagUInt8 (JCA::SYS::StringPool::intern ("Value" + NumStr), JCA::SYS::StringPool::intern ("Wert " + NumStr), "", false, TagUsage_T::UseData, &(Values[i]), "%", std::bind (&AcDimmers::calc, this)))->setRange (0, 100));
             Debug.println (FLAG_SETUP, false, Name, __func__, " > Tags Done");
           }
         }
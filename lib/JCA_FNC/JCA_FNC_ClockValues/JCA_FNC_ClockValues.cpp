@@ -55,9 +55,9 @@ namespace JCA {
       // Add new clock point tags
       for (uint8_t i = 0; i < CountClockPoints; i++) {
         String indexStr = String(i + 1);
-        Tags.push_back(new TagUInt32("Time" + indexStr, "Schaltpunkt " + indexStr, "", false, TagUsage_T::UseConfig, &ClockPoints[i].Time, "s", TagTypes_T::TypeTime));
-        Tags.push_back(new TagFloat("Value" + indexStr, "Wert " + indexStr, "", false, TagUsage_T::UseConfig, &ClockPoints[i].Value, ""));
-        Tags.push_back(new TagBool("DoRamp" + indexStr, "Rampen " + indexStr, "", false, TagUsage_T::UseConfig, &ClockPoints[i].DoRamp, "EIN", "AUS"));
+        Tags.push_back(new TagUInt32(JCA::SYS::StringPool::intern("Time" + indexStr), JCA::SYS::StringPool::intern("Schaltpunkt " + indexStr), "", false, TagUsage_T::UseConfig, &ClockPoints[i].Time, "s", TagTypes_T::TypeTime));
+        Tags.push_back(new TagFloat(JCA::SYS::StringPool::intern("Value" + indexStr), JCA::SYS::StringPool::intern("Wert " + indexStr), "", false, TagUsage_T::UseConfig, &ClockPoints[i].Value, ""));
+        Tags.push_back(new TagBool(JCA::SYS::StringPool::intern("DoRamp" + indexStr), JCA::SYS::StringPool::intern("Rampen " + indexStr), "", false, TagUsage_T::UseConfig, &ClockPoints[i].DoRamp, "EIN", "AUS"));
       }
     }
 
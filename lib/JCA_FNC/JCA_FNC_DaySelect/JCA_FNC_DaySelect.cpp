@@ -26,6 +26,8 @@ namespace JCA {
     DaySelect::DaySelect (String _Name)
         : FuncParent (_Name) {
       Debug.println (FLAG_SETUP, false, Name, __func__, "Create");
+      // Weekday changes once a day, checking every second is enough
+      UpdatePeriod = 1000;
       // Create Tag-List
       Tags.push_back (new TagUInt16 ("Days", "Tage", "0 = Sonntag", false, TagUsage_T::UseConfig, &Days, "", TagTypes_T::TypeDaySelect));
 
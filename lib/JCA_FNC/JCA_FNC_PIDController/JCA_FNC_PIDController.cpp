@@ -21,21 +21,23 @@ namespace JCA {
       Debug.println(FLAG_SETUP, false, Name, __func__, "Create");
 
       // Create Tag-List
+      const char *ProcessUnit = JCA::SYS::StringPool::intern (_ProcessUnit);
+      const char *OutputUnit = JCA::SYS::StringPool::intern (_OutputUnit);
       Tags.push_back (new TagFloat ("P", "Proportionaler Verstärkungsfaktor", "", false, TagUsage_T::UseConfig, &P, ""));
       Tags.push_back (new TagFloat ("Ti", "Integrationszeit", "", false, TagUsage_T::UseConfig, &Ti, "s"));
       Tags.push_back (new TagFloat ("Td", "Differentialzeit", "", false, TagUsage_T::UseConfig, &Td, "s"));
       Tags.push_back (new TagFloat ("TdLag", "Abklingkonstante für D-Anteil", "", false, TagUsage_T::UseConfig, &TdLag, "s"));
-      Tags.push_back (new TagFloat ("SetpointMin", "Minimaler Sollwert", "", false, TagUsage_T::UseConfig, &SetpointMin, _ProcessUnit));
-      Tags.push_back (new TagFloat ("SetpointMax", "Maximaler Sollwert", "", false, TagUsage_T::UseConfig, &SetpointMax, _ProcessUnit));
-      Tags.push_back (new TagFloat ("OutputMin", "Minimaler Stellwert", "", false, TagUsage_T::UseConfig, &OutputMin, _OutputUnit));
-      Tags.push_back (new TagFloat ("OutputMax", "Maximaler Stellwert", "", false, TagUsage_T::UseConfig, &OutputMax, _OutputUnit));
+      Tags.push_back (new TagFloat ("SetpointMin", "Minimaler Sollwert", "", false, TagUsage_T::UseConfig, &SetpointMin, ProcessUnit));
+      Tags.push_back (new TagFloat ("SetpointMax", "Maximaler Sollwert", "", false, TagUsage_T::UseConfig, &SetpointMax, ProcessUnit));
+      Tags.push_back (new TagFloat ("OutputMin", "Minimaler Stellwert", "", false, TagUsage_T::UseConfig, &OutputMin, OutputUnit));
+      Tags.push_back (new TagFloat ("OutputMax", "Maximaler Stellwert", "", false, TagUsage_T::UseConfig, &OutputMax, OutputUnit));
 
-      Tags.push_back (new TagFloat ("ProcessVar", "Istwert", "", false, TagUsage_T::UseData, &ProcessVar, _ProcessUnit));
-      Tags.push_back (new TagFloat ("Setpoint", "Sollwert", "", false, TagUsage_T::UseData, &Setpoint, _ProcessUnit));
+      Tags.push_back (new TagFloat ("ProcessVar", "Istwert", "", false, TagUsage_T::UseData, &ProcessVar, ProcessUnit));
+      Tags.push_back (new TagFloat ("Setpoint", "Sollwert", "", false, TagUsage_T::UseData, &Setpoint, ProcessUnit));
       Tags.push_back (new TagBool ("ManualSetpointMode", "Handmodus für den Sollwert", "", false, TagUsage_T::UseData, &ManualSetpointMode, "HAND", "AUTO"));
-      Tags.push_back (new TagFloat ("ManualSetpoint", "Manueller Sollwert", "", false, TagUsage_T::UseData, &ManualSetpoint, _ProcessUnit));
+      Tags.push_back (new TagFloat ("ManualSetpoint", "Manueller Sollwert", "", false, TagUsage_T::UseData, &ManualSetpoint, ProcessUnit));
       Tags.push_back (new TagBool ("ManualOutputMode", "Handmodus für den Stellwert", "", false, TagUsage_T::UseData, &ManualOutputMode, "HAND", "AUTO"));
-      Tags.push_back (new TagFloat ("Value", "Stellwert", "", true, TagUsage_T::UseData, &Value, _OutputUnit));
+      Tags.push_back (new TagFloat ("Value", "Stellwert", "", true, TagUsage_T::UseData, &Value, OutputUnit));
 
       P = 1.0;
       Ti = 1.0;
@@ -2,8 +2,10 @@
  * @file JCA_FNC_Parent.cpp
  * @author JCA (https://github.com/ichok)
  * @brief Parent Class of all Framework Elements.
- * @version 1.0
+ * @version 1.1
  * @date 2022-12-10
+ * @changelog
+ * - [1.1] 2026-10-17: Functions-File is written by a JsonWriter, Texts are escaped
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -43,6 +45,8 @@ namespace JCA {
     FuncParent::FuncParent (String _Name, String _Comment) {
       Name = _Name;
       Comment = _Comment;
+      UpdatePeriod = 0;
+      UpdatePhase = 0;
     }
 
     /**
@@ -53,9 +57,20 @@ namespace JCA {
     FuncParent::FuncParent (String _Name) : FuncParent (_Name, "") {
     }
 
-    String FuncParent::getName () {
+    const String &FuncParent::getName () {
       return Name;
     }
+
+    /**
+     * @brief Set the Update-Rate of the Function, overwrites the class defaults
+     *
+     * @param _Period Update-Period in ms, 0 = update every loop
+     * @param _Phase Offset of the first Update in ms, to spread Functions with the same Period
+     */
+    void FuncParent::setSchedule (uint32_t _Period, uint32_t _Phase) {
+      UpdatePeriod = _Period;
+      UpdatePhase = _Phase;
+    }
     
     /**
      * @brief Destroy the FuncParent::FuncParent object
@@ -69,44 +84,46 @@ namespace JCA {
     }
 
     /**
-     * @brief 
-     * 
-     * @param _FuncFile 
-     * @param _FilterUsage 
+     * @brief Write the Array of all Tags matching the Usage, nothing is written if no Tag matches
+     *
+     * @param _Writer Writer with the opened Function-Object
+     * @param _FilterUsage GetWebData or GetWebConfig
+     * @return true Array was written
      */
-    bool FuncParent::writeFunctionTags (File _FuncFile, TagUsage_T _FilterUsage) {
+    bool FuncParent::writeFunctionTags (JsonWriter &_Writer, TagUsage_T _FilterUsage) {
       Debug.println (FLAG_CONFIG, false, Name, __func__, "Write");
       int16_t Counter = 0;
-      String ObjectKey;
+      const char *ObjectKey;
       switch (_FilterUsage)
       {
       case TagUsage_T::GetWebData:
-        ObjectKey = String (JsonTagData);
+        ObjectKey = JsonTagData;
         break;
       case TagUsage_T::GetWebConfig:
-        ObjectKey = String (JsonTagConfig);
+        ObjectKey = JsonTagConfig;
         break;
 
       default:
-        ObjectKey = "";
+        ObjectKey = nullptr;
         break;
       }
 
-      if (ObjectKey.length () > 0) {
+      if (ObjectKey != nullptr) {
         for (size_t i = 0; i < Tags.size (); i++) {
           if (Tags[i]->Usage & _FilterUsage) {
             if (Counter == 0) {
-              _FuncFile.println ("\"" + ObjectKey + "\":[");
-              _FuncFile.println ("{" + Tags[i]->writeTag () + "}");
-            } else {
-              _FuncFile.println (",{" + Tags[i]->writeTag () + "}");
+              _Writer.key (ObjectKey);
+              _Writer.beginArray ();
             }
+            _Writer.beginObject ();
+            Tags[i]->writeTag (_Writer);
+            _Writer.endObject ();
             Counter++;
           }
         }
       }
       if (Counter > 0) {
-        _FuncFile.println ("]");
+        _Writer.endArray ();
       }
       return Counter > 0;
     }
@@ -194,24 +211,17 @@ namespace JCA {
     /**
      * @brief Write Element-Tags to the Functions-File
      *
-     * @param _SetupFile File to Write
-     * @param _ElementInit First Element added
+     * @param _Writer Writer with the opened Object of all Functions
      */
-    void FuncParent::writeFunction (File _FuncFile, bool &_Init) {
-      if (_Init) {
-        _FuncFile.print (",");
-      } else {
-        _Init = true;
-      }
-      _FuncFile.println ("\"" + Name + "\":{");
+    void FuncParent::writeFunction (JsonWriter &_Writer) {
+      _Writer.key (Name.c_str ());
+      _Writer.beginObject ();
       if (Comment.length () > 0) {
-        _FuncFile.println ("\"" + String (JsonTagComment) + "\":\"" + Comment + "\"");
-      }
-      if (writeFunctionTags (_FuncFile, TagUsage_T::GetWebConfig)) {
-        _FuncFile.println (",");
+        _Writer.member (JsonTagComment, Comment);
       }
-      writeFunctionTags (_FuncFile, TagUsage_T::GetWebData);
-      _FuncFile.println ("}");
+      writeFunctionTags (_Writer, TagUsage_T::GetWebConfig);
+      writeFunctionTags (_Writer, TagUsage_T::GetWebData);
+      _Writer.endObject ();
     }
 
     /**
@@ -243,14 +253,44 @@ namespace JCA {
      * @param _Name Name of the searched tag
      * @return int16_t position of the tag or -1 if not found
      */
-    int16_t FuncParent::getTagIndex (String _Name) {
+    int16_t FuncParent::getTagIndex (String _Name) const {
+      return getTagIndex (_Name.c_str ());
+    }
+
+    /**
+     * @brief Returns the position of a tag inside the Tags-Vector using the Hash-Index.
+     * Only reads the Index, so it can be called from several Tasks.
+     *
+     * @param _Name Name of the searched tag
+     * @return int16_t position of the tag or -1 if not found
+     */
+    int16_t FuncParent::getTagIndex (const char *_Name) const {
+      return TagIndex.find (_Name);
+    }
+
+    /**
+     * @brief Create the Hash-Index of all Tag-Names.
+     * Called once by the Creator (FuncHandler) after the Constructor has added all Tags.
+     */
+    void FuncParent::buildTagIndex () {
+      Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
+      TagIndex.reserve (Tags.size ());
       for (size_t i = 0; i < Tags.size (); i++) {
-        if (Tags[i]->Name == _Name) {
-          return i;
-        }
+        TagIndex.add (Tags[i]->Name, i);
+      }
+    }
+
+    /**
+     * @brief Get the tag object inside the Tags-Vector, used to link tags without JSON
+     *
+     * @param _Index Position of the tag
+     * @return TagParent* Pointer to the tag or nullptr if the index is invalid
+     */
+    TagParent *FuncParent::getTag (int16_t _Index) {
+      if (_Index < 0 || _Index >= (int16_t)Tags.size ()) {
+        return nullptr;
       }
-      // Tag was not found
-      return -1;
+      return Tags[_Index];
     }
 
     /**
@@ -2,8 +2,10 @@
  * @file JCA_FNC_Parent.h
  * @author JCA (https://github.com/ichok)
  * @brief Parent Class of all Framework Elements.
- * @version 1.0
+ * @version 1.1
  * @date 2022-12-10
+ * @changelog
+ * - [1.1] 2026-10-17: Functions-File is written by a JsonWriter, Texts are escaped
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -18,7 +20,10 @@
 #include <map>
 #include <vector>
 
+#include <JCA_SYS_Arena.h>
 #include <JCA_SYS_DebugOut.h>
+#include <JCA_SYS_JsonWriter.h>
+#include <JCA_SYS_NameIndex.h>
 #include <JCA_TAG_Parent.h>
 
 using namespace JCA::TAG;
@@ -35,12 +40,17 @@ namespace JCA {
       String Name;
       String Comment;
 
+      // Scheduling, used by the Function-Handler
+      uint32_t UpdatePeriod; ///< Update-Period in ms, 0 = update every loop
+      uint32_t UpdatePhase;  ///< Offset of the first Update in ms
+
       // Dataconfig
       std::vector<TagParent*> Tags;
+      JCA::SYS::NameIndex TagIndex; ///< Built once by buildTagIndex after the Tags are created
 
       // Create Parent-Structure
       // Functions Get/Set Data from/to Tag-Vector
-      bool writeFunctionTags (File _FuncFile, TagUsage_T _FilterUsage);
+      bool writeFunctionTags (JCA::SYS::JsonWriter &_Writer, TagUsage_T _FilterUsage);
 
       // Creation Sub-Functions
       static uint8_t GetSetupValueUINT8 (const char *_TagName, bool &_Done, JsonObject _Setup, JsonObject _Log);
@@ -71,11 +81,20 @@ namespace JCA {
       FuncParent (String _Name, String _Comment);
       FuncParent (String);
       virtual ~FuncParent();
-      String getName ();
-      void writeFunction (File _FuncFile, bool &_Init);
+      static void *operator new (size_t _Size) { return JCA::SYS::Arena::Objects.allocate (_Size); };
+      static void operator delete (void *_Ptr) { JCA::SYS::Arena::release (_Ptr); };
+      const String &getName ();
+      void setSchedule (uint32_t _Period, uint32_t _Phase);
+      uint32_t getUpdatePeriod () { return UpdatePeriod; };
+      uint32_t getUpdatePhase () { return UpdatePhase; };
+      void writeFunction (JCA::SYS::JsonWriter &_Writer);
       void setValues (JsonObject &_Function);
       void addValues (JsonObject &_Function);
-      int16_t getTagIndex (String _Name);
+      void buildTagIndex ();
+      int16_t getTagIndex (String _Name) const;
+      int16_t getTagIndex (const char *_Name) const;
+      TagParent *getTag (int16_t _Index);
+      size_t getTagCount () { return Tags.size (); };
       bool setTagValueByIndex (int16_t _Index, JsonVariant _Value);
       bool getTagValueByIndex (int16_t _Index, JsonVariant _Value);
       virtual void update (struct tm &_Time) { ; };
@@ -29,9 +29,12 @@ namespace JCA {
     ServerLink::ServerLink (JCA::IOT::Server *_ServerRef, String _Name)
         : FuncParent (_Name) {
       Debug.println (FLAG_SETUP, false, Name, __func__, "Create");
+      // Time-Strings have a resolution of one second
+      UpdatePeriod = 1000;
       // Create Tag-List
       Tags.push_back (new TagString ("Hostname", "Hostname", "Reboot erforderlich", false, TagUsage_T::UseConfig, &Hostname, std::bind (&ServerLink::setServerDataCB, this)));
       Tags.push_back (new TagUInt32 ("WsUpdateCycle", "Websocket Updatezyklus", "", false, TagUsage_T::UseConfig, &WsUpdateCycle, "ms", std::bind (&ServerLink::setServerDataCB, this)));
+      Tags.push_back (new TagUInt32 ("WsPushInterval", "Websocket Push", "Mindestabstand je Client, 0 = nur zyklisch", false, TagUsage_T::UseConfig, &WsPushInterval, "ms", std::bind (&ServerLink::setServerDataCB, this)));
       Tags.push_back (new TagUInt16 ("WebServerPort", "Webserver Port", "Reboot erforderlich", false, TagUsage_T::UseConfig, &WebServerPort, "", std::bind (&ServerLink::setServerDataCB, this)));
       Tags.push_back (new TagUInt16 ("UdpListenerPort", "UDP Port", "Reboot erforderlich", false, TagUsage_T::UseConfig, &UdpListenerPort, "", std::bind (&ServerLink::setServerDataCB, this)));
       Tags.push_back (new TagUInt32 ("LocalTimeZone", "Zeitzone", "", false, TagUsage_T::UseConfig, &LocalTimeZone, "s", std::bind (&ServerLink::setServerDataCB, this)));
@@ -56,6 +59,7 @@ namespace JCA {
     void ServerLink::setServerDataCB () {
       ServerRef->Hostname = Hostname;
       ServerRef->WsUpdateCycle = WsUpdateCycle;
+      ServerRef->WsPushInterval = WsPushInterval;
       ServerRef->WebServerPort = WebServerPort;
       ServerRef->UdpListenerPort = UdpListenerPort;
       ServerRef->LocalTimeZone = LocalTimeZone;
@@ -66,6 +70,7 @@ namespace JCA {
     void ServerLink::getServerDataCB () {
       Hostname = ServerRef->Hostname;
       WsUpdateCycle = ServerRef->WsUpdateCycle;
+      WsPushInterval = ServerRef->WsPushInterval;
       WebServerPort = ServerRef->WebServerPort;
       UdpListenerPort = ServerRef->UdpListenerPort;
       LocalTimeZone = ServerRef->LocalTimeZone;
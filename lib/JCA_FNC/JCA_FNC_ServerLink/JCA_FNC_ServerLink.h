@@ -2,8 +2,10 @@
  * @file JCA_FNC_WebserverLink.h
  * @author JCA (https://github.com/ichok)
  * @brief Interface to IOT_Webserver class
- * @version 0.1
+ * @version 0.2
  * @date 2024-04-22
+ * @changelog
+ * - [0.2] 2026-10-17: Tag for the WebSocket-Push Interval
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -45,6 +47,7 @@ namespace JCA {
       // Konfig
       String Hostname;
       uint32_t WsUpdateCycle;
+      uint32_t WsPushInterval;
       uint16_t WebServerPort;
       uint16_t UdpListenerPort;
       uint32_t LocalTimeZone;
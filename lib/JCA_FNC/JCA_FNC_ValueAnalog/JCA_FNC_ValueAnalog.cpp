@@ -27,8 +27,10 @@ namespace JCA {
     ValueAnalog::ValueAnalog (String _Name, String _Unit)
         : FuncParent (_Name) {
       Debug.println (FLAG_SETUP, false, Name, __func__, "Create");
+      // Update does nothing, the Value is only written by Links or the Server
+      UpdatePeriod = 1000;
       // Create Tag-List
-      Tags.push_back (new TagFloat ("Value", "Wert", "", false, TagUsage_T::UseData, &Value, _Unit));
+      Tags.push_back (new TagFloat ("Value", "Wert", "", false, TagUsage_T::UseData, &Value, JCA::SYS::StringPool::intern (_Unit)));
       // Init Data
       Value = false;
     }
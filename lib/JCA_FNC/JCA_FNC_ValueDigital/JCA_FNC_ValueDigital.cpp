@@ -26,6 +26,8 @@ namespace JCA {
     ValueDigital::ValueDigital (String _Name)
         : FuncParent (_Name) {
       Debug.println (FLAG_SETUP, false, Name, __func__, "Create");
+      // Nothing to calculate, run the empty update only once per second
+      UpdatePeriod = 1000;
       // Create Tag-List
       Tags.push_back (new TagBool ("Value", "Eingeschaltet", "", false, TagUsage_T::UseData, &Value, "EIN", "AUS"));
       // Init Data
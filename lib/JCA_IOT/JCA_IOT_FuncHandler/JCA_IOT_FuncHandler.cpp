@@ -1,4 +1,12 @@
 #include <JCA_IOT_FuncHandler.h>
+#ifdef ESP32
+  #include <esp_idf_version.h>
+  #if ESP_IDF_VERSION_MAJOR >= 5
+    #include <esp_app_desc.h>
+  #else
+    #include <esp_ota_ops.h>
+  #endif
+#endif
 using namespace JCA::SYS;
 using namespace JCA::TAG;
 
@@ -12,11 +20,21 @@ namespace JCA {
       Input = std::vector<FuncLinkPair_T>();
       Output = std::vector<FuncLinkPair_T>();
       Type = _Type;
+      Selector = nullptr;
+      SelectorCopy = nullptr;
+      Source = nullptr;
+      Propagated = false;
+      SelectorVersion = 0;
+      SourceVersion = 0;
+      Result = 0.0f;
     }
 
     FuncLink::~FuncLink() {
       Input.clear();
       Output.clear();
+      Targets.clear();
+      Operands.clear();
+      OperandValues.clear();
     }
 
     void FuncLink::addInput(FuncLinkPair_T _Input) {
@@ -35,10 +53,213 @@ namespace JCA {
       return Output[_Index];
     }
 
+    /**
+     * @brief Set the Expression of a Formula-Link, it is parsed by compile
+     *
+     * @param _Expr Expression like "in0*0.5+in1", the Inputs are numbered in the Order of "from"
+     */
+    void FuncLink::setExpression (const char *_Expr) {
+      Expr = _Expr;
+    }
+
+    /**
+     * @brief Resolve the Input- and Output-Pairs to Tag-Pointers and select the typed copy functions.
+     * Must be called after all Inputs and Outputs are added, the Functions-Vector must not change afterwards.
+     *
+     * @param _Functions List of all Functions, used to resolve the Pairs
+     * @param _Log Logging-Object of the Link
+     * @return true all Outputs could be linked
+     * @return false at least one Input or Output is missing or the Datatypes could not be converted
+     */
+    bool FuncLink::compile (std::vector<JCA::FNC::FuncParent *> &_Functions, JsonObject _Log) {
+      bool Done = true;
+      uint8_t SourceIndex = 0;
+      Selector = nullptr;
+      SelectorCopy = nullptr;
+      Source = nullptr;
+      Propagated = false;
+      Targets.clear ();
+      Operands.clear ();
+      OperandValues.clear ();
+
+      switch (Type) {
+      case FuncLinkType_T::LinkDirect:
+        // Direkt Link always read the first Input-Link and set it to all Output-Links
+        SourceIndex = 0;
+        break;
+
+      case FuncLinkType_T::LinkMove:
+        // Move Link use the first Input-Link to decide if the second Input-Link should be set to all Output-Link
+        SourceIndex = 1;
+        if (Input.size () > 0) {
+          Selector = _Functions[Input[0].Func]->getTag (Input[0].Tag);
+          if (Selector != nullptr) {
+            SelectorCopy = getTagCopyFunction (Selector->ValueType, TagTypes_T::TypeBool);
+          }
+        }
+        if (SelectorCopy == nullptr) {
+          Selector = nullptr;
+          _Log["Selector"] = "FAIL: missing or not convertible to bool";
+          Done = false;
+        }
+        break;
+
+      case FuncLinkType_T::LinkFormula:
+        // Formula Link calculate the Expression with all Input-Links and set the Result to all Output-Links
+        break;
+
+      default:
+        _Log["Compile"] = "FAIL: unknown Type";
+        return false;
+      }
+
+      TagTypes_T SourceType;
+      String SourceName;
+      if (Type == FuncLinkType_T::LinkFormula) {
+        JsonArray LogOperands = _Log["Operands"].to<JsonArray> ();
+        for (FuncLinkPair_T &Pair : Input) {
+          FuncLinkTag_T Operand;
+          Operand.Tag = _Functions[Pair.Func]->getTag (Pair.Tag);
+          Operand.Copy = nullptr;
+          Operand.Version = 0;
+          if (Operand.Tag != nullptr) {
+            Operand.Copy = getTagCopyFunction (Operand.Tag->ValueType, TagTypes_T::TypeFloat);
+          }
+          if (Operand.Copy == nullptr) {
+            LogOperands.add ("FAIL: missing or not convertible to float");
+            return false;
+          }
+          LogOperands.add ("OK: in" + String (Operands.size ()) + " = " + Operand.Tag->Name);
+          Operands.push_back (Operand);
+        }
+        if (!Formula.compile (Expr.c_str (), Operands.size ())) {
+          _Log["Formula"] = "FAIL: " + Formula.getError ();
+          Operands.clear ();
+          return false;
+        }
+        _Log["Formula"] = "OK: " + Expr;
+        OperandValues.resize (Operands.size ());
+        SourceType = TagTypes_T::TypeFloat;
+        SourceName = "Formula";
+      } else {
+        if (Input.size () > SourceIndex) {
+          Source = _Functions[Input[SourceIndex].Func]->getTag (Input[SourceIndex].Tag);
+        }
+        if (Source == nullptr) {
+          _Log["Source"] = "FAIL: missing";
+          return false;
+        }
+        SourceType = Source->ValueType;
+        SourceName = Source->Name;
+      }
+
+      JsonArray LogTargets = _Log["Compile"].to<JsonArray> ();
+      for (FuncLinkPair_T &Pair : Output) {
+        FuncLinkTag_T Target;
+        Target.Tag = _Functions[Pair.Func]->getTag (Pair.Tag);
+        Target.Copy = nullptr;
+        Target.Version = 0;
+        if (Target.Tag == nullptr) {
+          LogTargets.add ("FAIL: missing");
+          Done = false;
+        } else if (Target.Tag->ReadOnly) {
+          LogTargets.add (String ("FAIL: ") + Target.Tag->Name + " is readOnly");
+          Done = false;
+        } else {
+          Target.Copy = getTagCopyFunction (SourceType, Target.Tag->ValueType);
+          if (Target.Copy == nullptr) {
+            LogTargets.add ("FAIL: " + SourceName + " > " + Target.Tag->Name + " type not convertible");
+            Done = false;
+          } else {
+            // Sync the Shadow, so the first propagation detects a real change
+            Target.Tag->updateVersion ();
+            Targets.push_back (Target);
+            LogTargets.add ("OK: " + SourceName + " > " + Target.Tag->Name);
+          }
+        }
+      }
+      return Done;
+    }
+
+    /**
+     * @brief Copy the Source-Value to all Targets, using the compiled copy functions.
+     * Only done if the Version of the Source (or Selector) was changed since the last propagation,
+     * the Target-Callback is only executed if the Target-Value was realy changed.
+     */
+    void FuncLink::update () {
+      bool First = !Propagated;
+      void *Value;
+      if (Type == FuncLinkType_T::LinkFormula) {
+        if (!Formula.isValid ()) {
+          return;
+        }
+        // Recalculate only if at least one Operand was changed
+        bool Changed = First;
+        for (FuncLinkTag_T &Operand : Operands) {
+          Operand.Tag->updateVersion ();
+          if (Operand.Tag->Version != Operand.Version) {
+            Operand.Version = Operand.Tag->Version;
+            Changed = true;
+          }
+        }
+        if (!Changed) {
+          return;
+        }
+        Propagated = true;
+        for (size_t i = 0; i < Operands.size (); i++) {
+          Operands[i].Copy (Operands[i].Tag->Value, &OperandValues[i]);
+        }
+        Result = Formula.evaluate (OperandValues.data ());
+        Value = &Result;
+      } else {
+        if (Source == nullptr) {
+          return;
+        }
+        Source->updateVersion ();
+        if (Type == FuncLinkType_T::LinkMove) {
+          Selector->updateVersion ();
+          if (Propagated && Selector->Version == SelectorVersion && Source->Version == SourceVersion) {
+            return;
+          }
+          SelectorVersion = Selector->Version;
+          SourceVersion = Source->Version;
+          Propagated = true;
+          bool SelectorValue = false;
+          SelectorCopy (Selector->Value, &SelectorValue);
+          if (!SelectorValue) {
+            return;
+          }
+        } else {
+          if (Propagated && Source->Version == SourceVersion) {
+            return;
+          }
+          SourceVersion = Source->Version;
+          Propagated = true;
+        }
+        Value = Source->Value;
+      }
+      for (FuncLinkTag_T &Target : Targets) {
+        Target.Copy (Value, Target.Tag->Value);
+        if (Target.Tag->updateVersion () || First) {
+          Target.Tag->afterSet ();
+        }
+      }
+    }
+
     FuncHandler::FuncHandler (String _Name) {
       Name = _Name;
+      FirstCycle = false;
+      SnapshotFront = 0;
+      SnapshotMillis = 0;
+      SnapshotSequence[0] = 0;
+      SnapshotSequence[1] = 0;
+      ChangeSequence = 1; // 0 is used to request all Tags
+      SetupGeneration = 0;
+      CycleWritten = false;
+      CommandBatch.reserve (JCA_IOT_FUNCHANDLER_COMMAND_QUEUE);
       LinkMapping["direct"] = FuncLinkType_T::LinkDirect;
       LinkMapping["move"] = FuncLinkType_T::LinkMove;
+      LinkMapping["formula"] = FuncLinkType_T::LinkFormula;
     }
 
     /**
@@ -83,6 +304,8 @@ namespace JCA {
      * 
      */
     void FuncHandler::deleteLinks() {
+      Schedule.clear();
+      Order.clear();
       for (FuncLink *Link : Links) {
         delete Link;
 
@@ -90,6 +313,147 @@ namespace JCA {
       Links.clear();
     }
 
+    /**
+     * @brief Sort the Functions by the Link-Graph (topological order), so a value passes a chain
+     * of Functions in one loop. Each Link is executed right before the first Function it writes to.
+     * Functions inside a cycle keep their position from the Setup-File and are reported in the Log.
+     *
+     * @param _Log Logging-Object for the Order
+     * @return FuncPatchRet_T done or linkCycle if the Graph is not acyclic
+     */
+    FuncPatchRet_T FuncHandler::buildOrder (JsonObject _Log) {
+      Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
+      FuncPatchRet_T RetValue = FuncPatchRet_T::done;
+      size_t FuncCount = Functions.size ();
+      std::vector<std::vector<int16_t>> Successors (FuncCount);
+      std::vector<uint16_t> InDegree (FuncCount, 0);
+      std::vector<int16_t> Position (FuncCount, -1);
+      Order.clear ();
+
+      // Create Edges from each Input-Function to each Output-Function of a Link
+      for (FuncLink *Link : Links) {
+        for (uint8_t i = 0; i < Link->getInputCount (); i++) {
+          int16_t From = Link->getInput (i).Func;
+          for (uint8_t o = 0; o < Link->getOutputCount (); o++) {
+            int16_t To = Link->getOutput (o).Func;
+            // Feedback to the same Function is not an ordering constraint
+            if (From == To) {
+              continue;
+            }
+            if (std::find (Successors[From].begin (), Successors[From].end (), To) == Successors[From].end ()) {
+              Successors[From].push_back (To);
+              InDegree[To]++;
+            }
+          }
+        }
+      }
+
+      // Kahn's algorithm, always take the lowest free index to keep the Setup-Order where possible
+      std::vector<bool> Done (FuncCount, false);
+      for (size_t Step = 0; Step < FuncCount; Step++) {
+        int16_t Next = -1;
+        for (size_t i = 0; i < FuncCount; i++) {
+          if (!Done[i] && InDegree[i] == 0) {
+            Next = i;
+            break;
+          }
+        }
+        if (Next < 0) {
+          break;
+        }
+        Done[Next] = true;
+        Position[Next] = Order.size ();
+        Order.push_back ({ Next, std::vector<FuncLink *> (), true, false });
+        for (int16_t To : Successors[Next]) {
+          InDegree[To]--;
+        }
+      }
+
+      // Remaining Functions are part of a cycle
+      if (Order.size () < FuncCount) {
+        RetValue = FuncPatchRet_T::linkCycle;
+        JsonArray LogCycle = _Log["Cycle"].to<JsonArray> ();
+        for (size_t i = 0; i < FuncCount; i++) {
+          if (!Done[i]) {
+            Debug.print (FLAG_ERROR, true, Name, __func__, "Function inside a Link-Cycle : ");
+            Debug.println (FLAG_ERROR, true, Name, __func__, Functions[i]->getName ());
+            LogCycle.add (Functions[i]->getName ());
+            Position[i] = Order.size ();
+            Order.push_back ({ (int16_t)i, std::vector<FuncLink *> (), true, false });
+          }
+        }
+      }
+
+      // Attach each Link to the first Function it writes to
+      for (FuncLink *Link : Links) {
+        int16_t First = -1;
+        for (uint8_t o = 0; o < Link->getOutputCount (); o++) {
+          int16_t Pos = Position[Link->getOutput (o).Func];
+          if (First < 0 || Pos < First) {
+            First = Pos;
+          }
+        }
+        if (First >= 0) {
+          Order[First].Links.push_back (Link);
+        }
+      }
+
+      JsonArray LogOrder = _Log["Functions"].to<JsonArray> ();
+      for (FuncOrder_T &Entry : Order) {
+        LogOrder.add (Functions[Entry.Func]->getName ());
+      }
+      buildSchedule (_Log["Schedule"].to<JsonArray> ());
+      return RetValue;
+    }
+
+    /**
+     * @brief Compare two Schedule-Entries for the Min-Heap, safe for millis() overflow
+     */
+    static bool scheduleLater (const FuncSchedule_T &_A, const FuncSchedule_T &_B) {
+      return (long)(_A.Deadline - _B.Deadline) > 0;
+    }
+
+    /**
+     * @brief Create the Deadline-Heap for all Functions with an Update-Period.
+     * Functions without Period are updated every loop.
+     *
+     * @param _Log Logging-Array for the scheduled Functions
+     */
+    void FuncHandler::buildSchedule (JsonArray _Log) {
+      Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
+      unsigned long ActMillis = millis ();
+      Schedule.clear ();
+      for (size_t i = 0; i < Order.size (); i++) {
+        JCA::FNC::FuncParent *Function = Functions[Order[i].Func];
+        uint32_t Period = Function->getUpdatePeriod ();
+        Order[i].Always = (Period == 0);
+        Order[i].Due = false;
+        if (Period > 0) {
+          Schedule.push_back ({ ActMillis + Function->getUpdatePhase (), Period, (int16_t)i });
+          JsonObject Log = _Log.add<JsonObject> ();
+          Log["name"] = Function->getName ();
+          Log[JCA_IOT_FUNCHANDLER_SETUP_PERIOD] = Period;
+          Log[JCA_IOT_FUNCHANDLER_SETUP_PHASE] = Function->getUpdatePhase ();
+        }
+      }
+      std::make_heap (Schedule.begin (), Schedule.end (), scheduleLater);
+    }
+
+    /**
+     * @brief Mark all Functions with an elapsed Deadline as due and move their Deadline.
+     * Missed Periods are skipped, so the Function keeps its Phase and is not called in a burst.
+     */
+    void FuncHandler::runSchedule () {
+      unsigned long ActMillis = millis ();
+      while (!Schedule.empty () && (long)(ActMillis - Schedule.front ().Deadline) >= 0) {
+        std::pop_heap (Schedule.begin (), Schedule.end (), scheduleLater);
+        FuncSchedule_T &Entry = Schedule.back ();
+        Order[Entry.Order].Due = true;
+        Entry.Deadline += ((ActMillis - Entry.Deadline) / Entry.Period + 1) * Entry.Period;
+        std::push_heap (Schedule.begin (), Schedule.end (), scheduleLater);
+      }
+    }
+
     /**
      * @brief delete the Functions-Vector and all objects stored inside.
      * Also delete all Links.
@@ -100,67 +464,539 @@ namespace JCA {
         delete Function;
       }
       Functions.clear();
+      FuncIndex.clear();
+      FuncSetupKey.clear();
+      FuncCreated.clear();
     }
 
     /**
-     * @brief Read the Setup file and create Hardware-, Function- and LinkList
+     * @brief Skip Whitespaces and return the next Character without reading it
      *
+     * @param _Stream Stream to read from
+     * @return int next Character or -1 at the End of the Stream
      */
-    FuncPatchRet_T FuncHandler::setup () {
+    static int peekJsonToken (Stream &_Stream) {
+      while (true) {
+        int Char = _Stream.peek ();
+        if (Char != ' ' && Char != '\t' && Char != '\r' && Char != '\n') {
+          return Char;
+        }
+        _Stream.read ();
+      }
+    }
+
+    /**
+     * @brief Move the Stream behind the opening Bracket of a top level Array.
+     * Only the structure is tokenized, nothing of the Document is stored.
+     *
+     * @param _Stream Stream positioned at the Start of the Document
+     * @param _Key Key of the Array inside the root Object
+     * @return true Stream is positioned at the first Element
+     * @return false Key not found or not an Array
+     */
+    static bool findJsonArray (Stream &_Stream, const char *_Key) {
+      uint8_t Depth = 0;
+      char Key[33];
+      while (true) {
+        int Char = _Stream.read ();
+        if (Char < 0) {
+          return false;
+        }
+        if (Char == '"') {
+          size_t Length = 0;
+          bool Escape = false;
+          while (true) {
+            Char = _Stream.read ();
+            if (Char < 0) {
+              return false;
+            }
+            if (Escape) {
+              Escape = false;
+            } else if (Char == '\\') {
+              Escape = true;
+              continue;
+            } else if (Char == '"') {
+              break;
+            }
+            if (Length < sizeof (Key) - 1) {
+              Key[Length++] = Char;
+            }
+          }
+          Key[Length] = '\0';
+          if (Depth == 1 && peekJsonToken (_Stream) == ':') {
+            _Stream.read ();
+            if (strcmp (Key, _Key) == 0) {
+              if (peekJsonToken (_Stream) != '[') {
+                return false;
+              }
+              _Stream.read ();
+              return true;
+            }
+          }
+        } else if (Char == '{' || Char == '[') {
+          Depth++;
+        } else if (Char == '}' || Char == ']') {
+          if (Depth <= 1) {
+            return false;
+          }
+          Depth--;
+        }
+      }
+    }
+
+    /**
+     * @brief Consume the Separator before the next Array-Element
+     *
+     * @param _Stream Stream positioned behind the Bracket or the last Element
+     * @param _First true for the first Element, reset by the Function
+     * @return true another Element follows
+     * @return false End of the Array
+     */
+    static bool nextJsonElement (Stream &_Stream, bool &_First) {
+      int Char = peekJsonToken (_Stream);
+      if (_First) {
+        _First = false;
+      } else {
+        if (Char != ',') {
+          return false;
+        }
+        _Stream.read ();
+        Char = peekJsonToken (_Stream);
+      }
+      return (Char >= 0 && Char != ']');
+    }
+
+    /**
+     * @brief Write the Key of a Log-Section, the Log-File is written piece by piece
+     */
+    static void writeLogKey (File &_Log, bool &_First, const char *_Key) {
+      if (!_First) {
+        _Log.print (',');
+      }
+      _First = false;
+      _Log.print ('"');
+      _Log.print (_Key);
+      _Log.print ("\":");
+    }
+
+    /**
+     * @brief Read a top level Array of the Setup-File element by element, so only one Element
+     * and its Log are in RAM at the same time. Each Log is appended to the Log-File afterwards.
+     *
+     * @param _Setup Setup-File, will be rewound
+     * @param _Key Key of the Array inside the Setup-File
+     * @param _Log Log-File, the Section is only written if _LogFirst is not nullptr
+     * @param _LogFirst Log-File has no Section yet
+     * @param _Element Callback for each Element with the Setup- and the Log-Object
+     * @param _RetValue set to jsonSyntax if an Element could not be parsed
+     * @return true Array was found
+     * @return false Array not found
+     */
+    bool FuncHandler::readSetupArray (File &_Setup, const char *_Key, File &_Log, bool *_LogFirst, std::function<void (JsonObject, JsonObject)> _Element, FuncPatchRet_T &_RetValue) {
+      _Setup.seek (0);
+      if (!findJsonArray (_Setup, _Key)) {
+        return false;
+      }
+      if (_LogFirst) {
+        String LogKey = _Key;
+        LogKey.setCharAt (0, toupper (LogKey[0]));
+        writeLogKey (_Log, *_LogFirst, LogKey.c_str ());
+        _Log.print ('[');
+      }
+      JsonDocument SetupDoc;
+      JsonDocument LogDoc;
+      bool First = true;
+      bool LogFirst = true;
+      while (nextJsonElement (_Setup, First)) {
+        DeserializationError Error = deserializeJson (SetupDoc, _Setup);
+        if (Error) {
+          Debug.print (FLAG_ERROR, true, Name, __func__, "DeserializeJson failed: ");
+          Debug.println (FLAG_ERROR, true, Name, __func__, Error.c_str ());
+          _RetValue = FuncPatchRet_T::jsonSyntax;
+          break;
+        }
+        LogDoc.clear ();
+        _Element (SetupDoc.as<JsonObject> (), LogDoc.to<JsonObject> ());
+        if (_LogFirst) {
+          if (!LogFirst) {
+            _Log.print (',');
+          }
+          LogFirst = false;
+          serializeJson (LogDoc, _Log);
+        }
+      }
+      if (_LogFirst) {
+        _Log.print (']');
+      }
+      return true;
+    }
+
+    /**
+     * @brief Call the Creator of the Function-Type and apply the optional Update-Rate
+     *
+     * @param _Setup Setup-Object of the Function, the Type must exist in the FunctionList
+     * @param _Log Logging-Object of the Function
+     * @return true Function was added to the Functions-Vector
+     * @return false Creator failed
+     */
+    bool FuncHandler::createFunction (JsonObject _Setup, JsonObject _Log) {
+      size_t FuncCount = Functions.size ();
+      FunctionList[_Setup["type"].as<String> ()](_Setup, _Log, Functions, HardwareMapping);
+      if (Functions.size () == FuncCount) {
+        return false;
+      }
+      for (size_t i = FuncCount; i < Functions.size (); i++) {
+        Functions[i]->buildTagIndex ();
+      }
+      // Optional Update-Rate overwrites the class default
+      if (_Setup[JCA_IOT_FUNCHANDLER_SETUP_PERIOD].is<uint32_t> ()) {
+        Functions.back ()->setSchedule (_Setup[JCA_IOT_FUNCHANDLER_SETUP_PERIOD].as<uint32_t> (), _Setup[JCA_IOT_FUNCHANDLER_SETUP_PHASE].as<uint32_t> ());
+      }
+      return true;
+    }
+
+    /**
+     * @brief Fingerprint of a serialized Setup-Object, two Hashes and the Length
+     * must match before a running Function is kept
+     *
+     * @param _Text Setup-Object as JSON
+     * @return FuncSetupKey_T Fingerprint
+     */
+    static FuncSetupKey_T setupKey (const String &_Text) {
+      FuncSetupKey_T Key;
+      Key.Hash = NameIndex::hash (_Text.c_str ());
+      Key.Crc = JCA::SYS::Crc32 ((const uint8_t *)_Text.c_str (), _Text.length ());
+      Key.Length = _Text.length ();
+      return Key;
+    }
+
+    /**
+     * @brief Id of the running Firmware, the Hash of the Image created by the Build.
+     * It changes with every Change of the Code, not only of this File.
+     *
+     * @return uint32_t Hash of the Firmware-Id
+     */
+    uint32_t FuncHandler::firmwareId () {
+#if defined(ESP32)
+  #if ESP_IDF_VERSION_MAJOR >= 5
+      const esp_app_desc_t *App = esp_app_get_description ();
+  #else
+      const esp_app_desc_t *App = esp_ota_get_app_description ();
+  #endif
+      return NameIndex::hash (App->app_elf_sha256, sizeof (App->app_elf_sha256));
+#elif defined(ESP8266)
+      // Calculated once by the Core and kept
+      return NameIndex::hash (ESP.getSketchMD5 ().c_str ());
+#else
+      return NameIndex::hash (__DATE__ " " __TIME__);
+#endif
+    }
+
+    /**
+     * @brief Hash of the Names and Types of all Tags of a Function, the Cache holds Tag-Indices
+     * that are only valid for the same Layout
+     *
+     * @param _Function Function
+     * @return uint32_t Hash of the Tag-Layout
+     */
+    uint32_t FuncHandler::hashTagLayout (JCA::FNC::FuncParent *_Function) {
+      uint32_t Hash = NameIndex::hash ("");
+      for (size_t i = 0; i < _Function->getTagCount (); i++) {
+        TagParent *Tag = _Function->getTag (i);
+        uint8_t Type = (uint8_t)Tag->ValueType;
+        Hash = NameIndex::hash ((const uint8_t *)Tag->Name, strlen (Tag->Name) + 1, Hash);
+        Hash = NameIndex::hash (&Type, sizeof (Type), Hash);
+      }
+      return Hash;
+    }
+
+    /**
+     * @brief Hash of the Setup-File content, used to check if the compiled Cache is still valid.
+     * The Id of the Firmware is the Seed, a new Firmware never uses an old Cache.
+     *
+     * @return uint32_t Hash or 0 if the File is missing
+     */
+    uint32_t FuncHandler::hashSetupFile () {
+      if (!LittleFS.exists (JCA_IOT_FILE_SETUP)) {
+        return 0;
+      }
+      File SetupFile = LittleFS.open (JCA_IOT_FILE_SETUP, FILE_READ);
+      uint32_t Hash = firmwareId ();
+      uint8_t Buffer[64];
+      size_t Length;
+      while ((Length = SetupFile.read (Buffer, sizeof (Buffer))) > 0) {
+        Hash = NameIndex::hash (Buffer, Length, Hash);
+      }
+      SetupFile.close ();
+      return Hash;
+    }
+
+    /**
+     * @brief Write the compiled Cache of a successful Setup.
+     * Hardware- and Function-Elements are stored as MessagePack (the Creators need a JsonObject),
+     * Functions store the Count and Layout of their Tags, Links are stored with the resolved Function- and Tag-Indices.
+     *
+     * @param _SourceHash Hash of the Setup-File the Functions were created from
+     * @return FuncPatchRet_T done or an Error, the Cache-File is removed on Errors
+     */
+    FuncPatchRet_T FuncHandler::saveCache (uint32_t _SourceHash) {
       Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
       FuncPatchRet_T RetValue = FuncPatchRet_T::done;
-      JsonDocument SetupDoc;
+      File SetupFile = LittleFS.open (JCA_IOT_FILE_SETUP, FILE_READ);
+      File CacheFile = LittleFS.open (JCA_IOT_FILE_CACHE, FILE_WRITE);
+      if (!SetupFile || !CacheFile) {
+        RetValue = FuncPatchRet_T::fileOpen;
+      } else {
+        uint32_t Header[2] = { JCA_IOT_FUNCHANDLER_CACHE_MAGIC, _SourceHash };
+        CacheFile.write ((const uint8_t *)Header, sizeof (Header));
+
+        readSetupArray (SetupFile, JsonTagHardware, CacheFile, nullptr, [&] (JsonObject SetupHwObj, JsonObject Log) {
+          CacheFile.write ((uint8_t)'H');
+          serializeMsgPack (SetupHwObj, CacheFile);
+        }, RetValue);
+
+        size_t FuncPos = 0;
+        readSetupArray (SetupFile, JsonTagFunctions, CacheFile, nullptr, [&] (JsonObject SetupFuncObj, JsonObject Log) {
+          if (FuncPos < FuncSetupKey.size () && FuncPos < Functions.size ()) {
+            uint32_t Tags[2] = { (uint32_t)Functions[FuncPos]->getTagCount (), hashTagLayout (Functions[FuncPos]) };
+            CacheFile.write ((uint8_t)'F');
+            CacheFile.write ((const uint8_t *)&FuncSetupKey[FuncPos], sizeof (FuncSetupKey_T));
+            CacheFile.write ((const uint8_t *)Tags, sizeof (Tags));
+            serializeMsgPack (SetupFuncObj, CacheFile);
+          }
+          FuncPos++;
+        }, RetValue);
+        if (FuncPos != Functions.size ()) {
+          RetValue = FuncPatchRet_T::failed;
+        }
+
+        for (FuncLink *Link : Links) {
+          uint8_t Head[4] = { 'L', Link->Type, Link->getInputCount (), Link->getOutputCount () };
+          CacheFile.write (Head, sizeof (Head));
+          for (uint8_t i = 0; i < Link->getInputCount (); i++) {
+            FuncLinkPair_T Pair = Link->getInput (i);
+            CacheFile.write ((const uint8_t *)&Pair, sizeof (Pair));
+          }
+          for (uint8_t i = 0; i < Link->getOutputCount (); i++) {
+            FuncLinkPair_T Pair = Link->getOutput (i);
+            CacheFile.write ((const uint8_t *)&Pair, sizeof (Pair));
+          }
+          uint16_t ExprLength = Link->getExpression ().length ();
+          CacheFile.write ((const uint8_t *)&ExprLength, sizeof (ExprLength));
+          CacheFile.write ((const uint8_t *)Link->getExpression ().c_str (), ExprLength);
+        }
+        CacheFile.write ((uint8_t)'E');
+      }
+      if (SetupFile) {
+        SetupFile.close ();
+      }
+      if (CacheFile) {
+        CacheFile.close ();
+      }
+      if (RetValue != FuncPatchRet_T::done) {
+        LittleFS.remove (JCA_IOT_FILE_CACHE);
+      }
+      return RetValue;
+    }
+
+    /**
+     * @brief Create Hardware, Functions and Links from the compiled Cache, without parsing
+     * the Setup-File and without resolving Names. Only used if no Function is running.
+     *
+     * @param _SourceHash Hash of the current Setup-File
+     * @param _Log Log-File, gets a Cache-Section
+     * @param _LogFirst Log-File has no Section yet
+     * @return true Cache was valid and everything is created
+     * @return false Cache missing, outdated or broken, all created Functions are deleted again
+     */
+    bool FuncHandler::loadCache (uint32_t _SourceHash, File &_Log, bool &_LogFirst) {
+      if (!LittleFS.exists (JCA_IOT_FILE_CACHE)) {
+        return false;
+      }
+      Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
       JsonDocument LogDoc;
+      JsonDocument ElementDoc;
+      JsonDocument ElementLogDoc;
+      File CacheFile = LittleFS.open (JCA_IOT_FILE_CACHE, FILE_READ);
+      uint32_t Header[2] = { 0, 0 };
+      bool Done = CacheFile.read ((uint8_t *)Header, sizeof (Header)) == sizeof (Header);
+      if (!Done || Header[0] != JCA_IOT_FUNCHANDLER_CACHE_MAGIC || Header[1] != _SourceHash) {
+        LogDoc["Error"] = "outdated";
+        Done = false;
+      }
+
+      bool End = false;
+      while (Done && !End) {
+        ElementLogDoc.clear ();
+        JsonObject ElementLog = ElementLogDoc.to<JsonObject> ();
+        switch (CacheFile.read ()) {
+        case 'H':
+          if (deserializeMsgPack (ElementDoc, CacheFile) || HardwareList.count (ElementDoc["type"]) != 1) {
+            Done = false;
+          } else if (HardwareMapping.count (ElementDoc["type"]) == 0) {
+            HardwareList[ElementDoc["type"].as<String> ()](ElementDoc.as<JsonObject> (), ElementLog, HardwareMapping);
+          }
+          break;
+
+        case 'F': {
+          FuncSetupKey_T Key;
+          uint32_t Tags[2];
+          if (CacheFile.read ((uint8_t *)&Key, sizeof (Key)) != sizeof (Key) || CacheFile.read ((uint8_t *)Tags, sizeof (Tags)) != sizeof (Tags) || deserializeMsgPack (ElementDoc, CacheFile) || FunctionList.count (ElementDoc["type"]) != 1) {
+            Done = false;
+          } else if (!createFunction (ElementDoc.as<JsonObject> (), ElementLog)) {
+            Done = false;
+          } else if (Functions.back ()->getTagCount () != Tags[0] || hashTagLayout (Functions.back ()) != Tags[1]) {
+            // The Tags of the Function-Class changed, the cached Indices are not valid anymore
+            ElementLog["Tags"] = "FAIL: Layout changed";
+            Done = false;
+          } else {
+            FuncSetupKey.push_back (Key);
+            FuncCreated.push_back (true);
+          }
+          break;
+        }
 
-      if (!LittleFS.exists(JCA_IOT_FILE_SETUP)) {
-        JsonObject LogObj = LogDoc["File"].to<JsonObject>();
-        LogObj["Name"] = JCA_IOT_FILE_SETUP;
-        LogObj["Error"] = "not found";
+        case 'L': {
+          uint8_t Head[3];
+          if (CacheFile.read (Head, sizeof (Head)) != sizeof (Head) || Head[0] == FuncLinkType_T::LinkNone || Head[0] > FuncLinkType_T::LinkFormula) {
+            Done = false;
+            break;
+          }
+          FuncLink *Link = new FuncLink ((FuncLinkType_T)Head[0]);
+          Links.push_back (Link);
+          for (uint16_t i = 0; Done && i < Head[1] + Head[2]; i++) {
+            FuncLinkPair_T Pair;
+            if (CacheFile.read ((uint8_t *)&Pair, sizeof (Pair)) != sizeof (Pair) || Pair.Func < 0 || Pair.Func >= (int16_t)Functions.size ()) {
+              Done = false;
+            } else if (Pair.Tag < 0 || (size_t)Pair.Tag >= Functions[Pair.Func]->getTagCount ()) {
+              ElementLog["Tag"] = "FAIL: Index out of Range";
+              Done = false;
+            } else if (i < Head[1]) {
+              Link->addInput (Pair);
+            } else {
+              Link->addOutput (Pair);
+            }
+          }
+          uint16_t ExprLength = 0;
+          if (Done && CacheFile.read ((uint8_t *)&ExprLength, sizeof (ExprLength)) == sizeof (ExprLength)) {
+            String Expr;
+            Expr.reserve (ExprLength);
+            for (uint16_t i = 0; i < ExprLength; i++) {
+              Expr += (char)CacheFile.read ();
+            }
+            Link->setExpression (Expr.c_str ());
+          } else {
+            Done = false;
+          }
+          if (Done && !Link->compile (Functions, ElementLog)) {
+            Done = false;
+          }
+          break;
+        }
+
+        case 'E':
+          End = true;
+          break;
+
+        default:
+          Done = false;
+          break;
+        }
+        if (!Done && ElementLog.size () > 0) {
+          LogDoc["Element"] = ElementLog;
+        }
+      }
+      CacheFile.close ();
+
+      if (Done) {
+        LogDoc["Functions"] = Functions.size ();
+        LogDoc["Links"] = Links.size ();
+      } else {
+        Debug.println (FLAG_ERROR, true, Name, __func__, "Cache not usable");
+        deleteFunctions ();
+      }
+      LogDoc["Done"] = Done;
+      writeLogKey (_Log, _LogFirst, "Cache");
+      serializeJson (LogDoc, _Log);
+      return Done;
+    }
+
+    /**
+     * @brief Read the Setup file and create Hardware-, Function- and LinkList.
+     * Running Functions with the same Name and an identical Setup-Object are kept with their State,
+     * all other Functions are deleted and recreated. Links are always rebuild.
+     * The Setup-File is read element by element and the Log is written the same way,
+     * so the Peak-Memory depends on the largest Element and not on the File.
+     */
+    FuncPatchRet_T FuncHandler::setup () {
+      Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
+      FuncPatchRet_T RetValue = FuncPatchRet_T::done;
+      unsigned long SetupMillis = millis ();
+      File LogFile = LittleFS.open (JCA_IOT_FILE_LOG, FILE_WRITE);
+      bool LogFirst = true;
+      LogFile.print ('{');
+
+      uint32_t SourceHash = hashSetupFile ();
+      if (SourceHash != 0 && Functions.empty () && loadCache (SourceHash, LogFile, LogFirst)) {
+        // Boot from the compiled Cache, usrFunctions.json belongs to the same Setup
+        buildFuncIndex ();
+        JsonDocument OrderDoc;
+        RetValue = buildOrder (OrderDoc.to<JsonObject> ());
+        writeLogKey (LogFile, LogFirst, "Order");
+        serializeJson (OrderDoc, LogFile);
+        if (!LittleFS.exists (JCA_IOT_FILE_FUNCTIONS)) {
+          saveFunctions ();
+        }
+      } else if (!LittleFS.exists(JCA_IOT_FILE_SETUP)) {
+        JsonDocument LogDoc;
+        LogDoc["Name"] = JCA_IOT_FILE_SETUP;
+        LogDoc["Error"] = "not found";
+        writeLogKey (LogFile, LogFirst, "File");
+        serializeJson (LogDoc, LogFile);
         RetValue = FuncPatchRet_T::fileMissing;
       } else {
-        // Open Setup File
+        // Open Setup File and check the Syntax, the empty Filter stores nothing
         File SetupFile = LittleFS.open (JCA_IOT_FILE_SETUP, FILE_READ);
-        DeserializationError Error = deserializeJson (SetupDoc, SetupFile);
+        JsonDocument CheckDoc;
+        JsonDocument CheckFilter;
+        CheckFilter.set (false);
+        DeserializationError Error = deserializeJson (CheckDoc, SetupFile, DeserializationOption::Filter (CheckFilter));
 
         if (Error) {
           Debug.print (FLAG_ERROR, true, Name, __func__, "DeserializeJson failed: ");
           Debug.println (FLAG_ERROR, true, Name, __func__, Error.c_str());
-          JsonObject LogObj = LogDoc["File"].to<JsonObject>();
-          LogObj["Name"] = JCA_IOT_FILE_SETUP;
-          LogObj["Error"] = Error.c_str ();
+          JsonDocument LogDoc;
+          LogDoc["Name"] = JCA_IOT_FILE_SETUP;
+          LogDoc["Error"] = Error.c_str ();
+          writeLogKey (LogFile, LogFirst, "File");
+          serializeJson (LogDoc, LogFile);
           RetValue = FuncPatchRet_T::jsonSyntax;
         } else {
-          JsonObject SetupObj = SetupDoc.as<JsonObject>();
-
-          // First have to delete alle Functions and Links to rebuild the Vectors
-          deleteFunctions();
+          // Links hold Tag-Pointers and Function-Indices, they are always rebuild
+          deleteLinks();
 
           //-------------------------------------------------------
           // HardwareMapping 
           //-------------------------------------------------------
-          if (SetupObj[JsonTagHardware].is<JsonArray>()) {
-            Debug.println (FLAG_SETUP, true, Name, __func__, "Found Hardware");
-            JsonArray LogArray = LogDoc["Hardware"].to<JsonArray>();
-            JsonArray SetupHwArr = SetupObj[JsonTagHardware].as<JsonArray>();
-            for (JsonObject SetupHwObj : SetupHwArr) {
-              Debug.println (FLAG_SETUP, true, Name, __func__, SetupHwObj["type"].as<String>());
-              JsonObject Log = LogArray.add<JsonObject>();
-              if (HardwareList.count(SetupHwObj["type"]) == 1) {
-                // Hardware found in creator List -> Call Creator and add to HardwareMapping
-                if (HardwareMapping.count (SetupHwObj["type"]) == 0) {
-                  // Add Hardware only once
-                  HardwareList[SetupHwObj["type"].as<String> ()](SetupHwObj, Log, HardwareMapping);
-                }
-              } else {
-                // Hardware not found, log error
-                Debug.print (FLAG_ERROR, true, Name, __func__, "Hardware not found in Hardware List : ");
-                Debug.println (FLAG_ERROR, true, Name, __func__, SetupHwObj["type"].as<String> ());
-                Log["Fault"] = "Type not found" + SetupHwObj["type"].as<String> ();
-                if (RetValue > FuncPatchRet_T::hardwareMissing) {
-                  RetValue = FuncPatchRet_T::hardwareMissing;
-                }
+          bool Found = readSetupArray (SetupFile, JsonTagHardware, LogFile, &LogFirst, [&] (JsonObject SetupHwObj, JsonObject Log) {
+            Debug.println (FLAG_SETUP, true, Name, __func__, SetupHwObj["type"].as<String>());
+            if (HardwareList.count(SetupHwObj["type"]) == 1) {
+              // Hardware found in creator List -> Call Creator and add to HardwareMapping
+              if (HardwareMapping.count (SetupHwObj["type"]) == 0) {
+                // Add Hardware only once
+                HardwareList[SetupHwObj["type"].as<String> ()](SetupHwObj, Log, HardwareMapping);
+              }
+            } else {
+              // Hardware not found, log error
+              Debug.print (FLAG_ERROR, true, Name, __func__, "Hardware not found in Hardware List : ");
+              Debug.println (FLAG_ERROR, true, Name, __func__, SetupHwObj["type"].as<String> ());
+              Log["Fault"] = "Type not found" + SetupHwObj["type"].as<String> ();
+              if (RetValue > FuncPatchRet_T::hardwareMissing) {
+                RetValue = FuncPatchRet_T::hardwareMissing;
               }
             }
+          }, RetValue);
+          if (Found) {
             if (Debug.print (FLAG_SETUP, true, Name, __func__, "Done > HardwareMapping[")) {
               Debug.print (FLAG_SETUP, true, Name, __func__, HardwareMapping.size ());
               Debug.println (FLAG_SETUP, true, Name, __func__, "]");
@@ -170,16 +1006,62 @@ namespace JCA {
           //-------------------------------------------------------
           // FunctionList
           //-------------------------------------------------------
-          if (SetupObj[JsonTagFunctions].is<JsonArray>()) {
+          // Keep all running Functions with unchanged Name and Setup, delete the others
+          // before creating the new ones, so Hardware (Pins, Timers) is released first
+          std::vector<FuncSetupKey_T> SetupKey;
+          std::vector<int16_t> Reuse;
+          std::vector<bool> Kept (Functions.size (), false);
+          Found = readSetupArray (SetupFile, JsonTagFunctions, LogFile, nullptr, [&] (JsonObject SetupFuncObj, JsonObject Log) {
+            String SetupText;
+            serializeJson (SetupFuncObj, SetupText);
+            SetupKey.push_back (setupKey (SetupText));
+            int16_t Running = -1;
+            if (SetupFuncObj[JCA_IOT_FUNCHANDLER_SETUP_NAME].is<const char *> ()) {
+              Running = getFuncIndex (SetupFuncObj[JCA_IOT_FUNCHANDLER_SETUP_NAME].as<const char *> ());
+            }
+            if (Running >= 0 && !Kept[Running] && FuncSetupKey[Running] == SetupKey.back ()) {
+              Kept[Running] = true;
+            } else {
+              Running = -1;
+            }
+            Reuse.push_back (Running);
+          }, RetValue);
+
+          if (!Found || RetValue == FuncPatchRet_T::jsonSyntax) {
+            deleteFunctions ();
+          } else {
             Debug.println (FLAG_SETUP, true, Name, __func__, "Found Functions");
-            JsonArray LogArray = LogDoc["Functions"].to<JsonArray>();
-            JsonArray SetupFuncArr = SetupObj[JsonTagFunctions].as<JsonArray> ();
-            for (JsonObject SetupFuncObj : SetupFuncArr) {
+            std::vector<JCA::FNC::FuncParent *> Running;
+            Running.swap (Functions);
+            for (size_t i = 0; i < Running.size (); i++) {
+              if (!Kept[i]) {
+                delete Running[i];
+              }
+            }
+            FuncIndex.clear ();
+            FuncSetupKey.clear ();
+            FuncCreated.clear ();
+
+            size_t SetupIndex = 0;
+            readSetupArray (SetupFile, JsonTagFunctions, LogFile, &LogFirst, [&] (JsonObject SetupFuncObj, JsonObject Log) {
               Debug.println (FLAG_SETUP, true, Name, __func__, SetupFuncObj["type"].as<String> ());
-              JsonObject Log = LogArray.add<JsonObject>();
-              if (FunctionList.count (SetupFuncObj["type"]) == 1) {
+              if (SetupIndex >= Reuse.size ()) {
+                return;
+              }
+              int16_t RunningIndex = Reuse[SetupIndex];
+              FuncSetupKey_T Key = SetupKey[SetupIndex];
+              SetupIndex++;
+              if (RunningIndex >= 0) {
+                // Unchanged Function keeps its Instance and State
+                Functions.push_back (Running[RunningIndex]);
+                FuncSetupKey.push_back (Key);
+                FuncCreated.push_back (false);
+                Log["kept"] = Functions.back ()->getName ();
+              } else if (FunctionList.count (SetupFuncObj["type"]) == 1) {
                 // Function found in creator List -> Call Creator and add to Function Vector
-                FunctionList[SetupFuncObj["type"].as<String> ()](SetupFuncObj, Log, Functions, HardwareMapping);
+                createFunction (SetupFuncObj, Log);
+                FuncSetupKey.resize (Functions.size (), Key);
+                FuncCreated.resize (Functions.size (), true);
               } else {
                 // Function not found, log error
                 Debug.print (FLAG_ERROR, true, Name, __func__, "Function not found in Function List : ");
@@ -189,7 +1071,9 @@ namespace JCA {
                   RetValue = FuncPatchRet_T::functionMissing;
                 }
               }
-            }
+            }, RetValue);
+            // The Links below resolve their Names with the new Index
+            buildFuncIndex ();
             if (Debug.print (FLAG_SETUP, true, Name, __func__, "Done > Functions[")) {
               Debug.print (FLAG_SETUP, true, Name, __func__, Functions.size ());
               Debug.println (FLAG_SETUP, true, Name, __func__, "]");
@@ -199,77 +1083,104 @@ namespace JCA {
           //-------------------------------------------------------
           // Links
           //-------------------------------------------------------
-          if (SetupObj[JsonTagLinks].is<JsonArray>()) {
-            Debug.println (FLAG_SETUP, true, Name, __func__, "Found Links");
-            JsonArray LogArray = LogDoc["Links"].to<JsonArray>();
-            JsonArray SetupLinkArr = SetupObj[JsonTagLinks].as<JsonArray> ();
-            for (JsonObject SetupLinkObj : SetupLinkArr) {
-              Debug.println (FLAG_SETUP, true, Name, __func__, SetupLinkObj["type"].as<String> ());
-              JsonObject Log = LogArray.add<JsonObject>();
-              if (LinkMapping.count (SetupLinkObj["type"]) == 1) {
-                // Create Link
-                Links.push_back (new FuncLink (LinkMapping[SetupLinkObj["type"].as<String> ()]));
-                Log["Type"] = SetupLinkObj["type"].as<String> ();
-                size_t Link = Links.size() - 1;
-                int16_t FuncIndex;
-                int16_t TagIndex;
-
-
-                // Add all From Pointer
-                JsonArray FromArr = SetupLinkObj["from"].as<JsonArray> ();
-                JsonArray LogFrom = Log["IN"].to<JsonArray>();
-                for (JsonObject FromObj : FromArr) {
-                  if (checkLink (FromObj["func"].as<String> (), FuncIndex, FromObj["tag"].as<String> (), TagIndex, LogArray)) {
-                    Links[Link]->addInput ({ FuncIndex, TagIndex });
-                    LogFrom.add ("OK: FuncIndex=" + String(FuncIndex) + " TagIndex=" + String(TagIndex));
-                  } else {
-                    LogFrom.add ("FAIL: " + FromObj["func"].as<String> () + "_" + FromObj["tag"].as<String> ());
-                    if (RetValue > FuncPatchRet_T::linkObjMissing) {
-                      RetValue = FuncPatchRet_T::linkObjMissing;
-                    }
+          Found = readSetupArray (SetupFile, JsonTagLinks, LogFile, &LogFirst, [&] (JsonObject SetupLinkObj, JsonObject Log) {
+            Debug.println (FLAG_SETUP, true, Name, __func__, SetupLinkObj["type"].as<String> ());
+            if (LinkMapping.count (SetupLinkObj["type"]) == 1) {
+              // Create Link
+              Links.push_back (new FuncLink (LinkMapping[SetupLinkObj["type"].as<String> ()]));
+              Log["Type"] = SetupLinkObj["type"].as<String> ();
+              size_t Link = Links.size() - 1;
+              int16_t FuncIndex;
+              int16_t TagIndex;
+              JsonArray LogMissing = Log["Missing"].to<JsonArray> ();
+
+              // Add all From Pointer
+              JsonArray FromArr = SetupLinkObj["from"].as<JsonArray> ();
+              JsonArray LogFrom = Log["IN"].to<JsonArray>();
+              for (JsonObject FromObj : FromArr) {
+                if (checkLink (FromObj["func"].as<String> (), FuncIndex, FromObj["tag"].as<String> (), TagIndex, LogMissing)) {
+                  Links[Link]->addInput ({ FuncIndex, TagIndex });
+                  LogFrom.add ("OK: FuncIndex=" + String(FuncIndex) + " TagIndex=" + String(TagIndex));
+                } else {
+                  LogFrom.add ("FAIL: " + FromObj["func"].as<String> () + "_" + FromObj["tag"].as<String> ());
+                  if (RetValue > FuncPatchRet_T::linkObjMissing) {
+                    RetValue = FuncPatchRet_T::linkObjMissing;
                   }
                 }
+              }
 
-                // Add all To Pointer
-                JsonArray ToArr = SetupLinkObj["to"].as<JsonArray> ();
-                JsonArray LogTo = Log["OUT"].to<JsonArray>();
-                for (JsonObject ToObj : ToArr) {
-                  if (checkLink (ToObj["func"].as<String> (), FuncIndex, ToObj["tag"].as<String> (), TagIndex, LogArray)) {
-                    Links[Link]->addOutput ({ FuncIndex, TagIndex });
-                    LogTo.add ("OK: FuncIndex=" + String (FuncIndex) + " TagIndex=" + String (TagIndex));
-                  } else {
-                    LogTo.add ("FAIL: " + ToObj["func"].as<String> () + "_" + ToObj["tag"].as<String> ());
-                    if (RetValue > FuncPatchRet_T::linkObjMissing) {
-                      RetValue = FuncPatchRet_T::linkObjMissing;
-                    }
+              // Add all To Pointer
+              JsonArray ToArr = SetupLinkObj["to"].as<JsonArray> ();
+              JsonArray LogTo = Log["OUT"].to<JsonArray>();
+              for (JsonObject ToObj : ToArr) {
+                if (checkLink (ToObj["func"].as<String> (), FuncIndex, ToObj["tag"].as<String> (), TagIndex, LogMissing)) {
+                  Links[Link]->addOutput ({ FuncIndex, TagIndex });
+                  LogTo.add ("OK: FuncIndex=" + String (FuncIndex) + " TagIndex=" + String (TagIndex));
+                } else {
+                  LogTo.add ("FAIL: " + ToObj["func"].as<String> () + "_" + ToObj["tag"].as<String> ());
+                  if (RetValue > FuncPatchRet_T::linkObjMissing) {
+                    RetValue = FuncPatchRet_T::linkObjMissing;
                   }
                 }
-              } else {
-                // Function not found, log error
-                Debug.print (FLAG_ERROR, true, Name, __func__, "Link-Type not defined : ");
-                Debug.println (FLAG_ERROR, true, Name, __func__, SetupLinkObj["type"].as<String> ());
-                Log["Fault"] = "Type not found" + SetupLinkObj["type"].as<String> ();
-                if (RetValue > FuncPatchRet_T::linkTypMissing) {
-                  RetValue = FuncPatchRet_T::linkTypMissing;
+              }
+
+              if (SetupLinkObj[JCA_IOT_FUNCHANDLER_SETUP_EXPR].is<const char *> ()) {
+                Links[Link]->setExpression (SetupLinkObj[JCA_IOT_FUNCHANDLER_SETUP_EXPR].as<const char *> ());
+              }
+
+              // Resolve Tags and Datatypes (and parse the Formula)
+              if (!Links[Link]->compile (Functions, Log)) {
+                if (RetValue > FuncPatchRet_T::linkCompileFailed) {
+                  RetValue = FuncPatchRet_T::linkCompileFailed;
                 }
               }
+            } else {
+              // Function not found, log error
+              Debug.print (FLAG_ERROR, true, Name, __func__, "Link-Type not defined : ");
+              Debug.println (FLAG_ERROR, true, Name, __func__, SetupLinkObj["type"].as<String> ());
+              Log["Fault"] = "Type not found" + SetupLinkObj["type"].as<String> ();
+              if (RetValue > FuncPatchRet_T::linkTypMissing) {
+                RetValue = FuncPatchRet_T::linkTypMissing;
+              }
             }
+          }, RetValue);
+          if (Found) {
             if (Debug.print (FLAG_SETUP, true, Name, __func__, "Done > Links[")) {
               Debug.print (FLAG_SETUP, true, Name, __func__, Links.size ());
               Debug.println (FLAG_SETUP, true, Name, __func__, "]");
             }
           }
 
+          //-------------------------------------------------------
+          // Execution Order
+          //-------------------------------------------------------
+          JsonDocument OrderDoc;
+          FuncPatchRet_T OrderRet = buildOrder (OrderDoc.to<JsonObject> ());
+          if (RetValue > OrderRet) {
+            RetValue = OrderRet;
+          }
+          writeLogKey (LogFile, LogFirst, "Order");
+          serializeJson (OrderDoc, LogFile);
+
           // write Functions File to used by Webpage
           saveFunctions ();
         }
         SetupFile.close ();
+
+        // Only a complete Setup is worth to be cached
+        if (RetValue == FuncPatchRet_T::done) {
+          saveCache (SourceHash);
+        } else {
+          LittleFS.remove (JCA_IOT_FILE_CACHE);
+        }
       }
 
-      // Write Logfile
-      File LogFile = LittleFS.open (JCA_IOT_FILE_LOG, FILE_WRITE);
-      serializeJson (LogDoc, LogFile);
+      // Close Logfile
+      writeLogKey (LogFile, LogFirst, "Millis");
+      LogFile.print (millis () - SetupMillis);
+      LogFile.print ('}');
       LogFile.close ();
+      FirstCycle = true;
 
       Debug.println (FLAG_SETUP, true, Name, __func__, "Done");
       return RetValue;
@@ -283,6 +1194,7 @@ namespace JCA {
       FuncPatchRet_T RetValue = FuncPatchRet_T::done;
       deleteFunctions ();
       LittleFS.remove(JCA_IOT_FILE_FUNCTIONS);
+      LittleFS.remove(JCA_IOT_FILE_CACHE);
       return RetValue;
     }
 
@@ -299,13 +1211,15 @@ namespace JCA {
       if (!FuncFile) {
         RetValue = FuncPatchRet_T::fileOpen;
       } else {
-        bool InitDone = false;
-        // Create Object with all Functions inside
-        FuncFile.println ("{");
+        // Create Object with all Functions inside, the Writer passes the File in Blocks
+        JCA::SYS::JsonWriter Writer (FuncFile);
+        Writer.beginObject ();
         for (size_t i = 0; i < Functions.size (); i++) {
-          Functions[i]->writeFunction (FuncFile, InitDone);
+          Functions[i]->writeFunction (Writer);
         }
-        FuncFile.println ("}");
+        Writer.endObject ();
+        Writer.flush ();
+        Debug.println (FLAG_CONFIG, true, Name, __func__, String ("Bytes: ") + String (Writer.getWritten ()));
         // Close File
         FuncFile.close ();
       }
@@ -326,7 +1240,8 @@ namespace JCA {
     FuncPatchRet_T FuncHandler::saveValues () {
       FuncPatchRet_T RetValue = FuncPatchRet_T::done;
       Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
-      JsonDocument ValueDoc;
+      PooledDoc Pooled (DocPool::Requests);
+      JsonDocument &ValueDoc = *Pooled;
       JsonObject Values = ValueDoc[JCA::FNC::FuncParent::JsonTagElements].to<JsonObject>(); //.as<JsonObject>();
       getValues (Values);
       File ValuesFile = LittleFS.open (JCA_IOT_FILE_VALUES, FILE_WRITE);
@@ -346,11 +1261,14 @@ namespace JCA {
     /**
      * @brief load Values stored in File (Default: usrValues.json) 
      * and set the Functions Values
+     *
+     * @param _OnlyCreated only set Functions (re)created by the last Setup
      */
-    FuncPatchRet_T FuncHandler::loadValues () {
+    FuncPatchRet_T FuncHandler::loadValues (bool _OnlyCreated) {
       FuncPatchRet_T RetValue = FuncPatchRet_T::done;
       Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
-      JsonDocument ValueDoc;
+      PooledDoc Pooled (DocPool::Requests);
+      JsonDocument &ValueDoc = *Pooled;
       if (!LittleFS.exists (JCA_IOT_FILE_VALUES)) {
         Debug.print (FLAG_ERROR, true, Name, __func__, "File not found : ");
         Debug.println (FLAG_ERROR, true, Name, __func__, JCA_IOT_FILE_VALUES);
@@ -364,7 +1282,7 @@ namespace JCA {
           RetValue = FuncPatchRet_T::jsonSyntax;
         } else if (ValueDoc[JCA::FNC::FuncParent::JsonTagElements].is<JsonObject>()) {
           JsonObject Values = ValueDoc[JCA::FNC::FuncParent::JsonTagElements].as<JsonObject> ();
-          setValues (Values);
+          setValues (Values, _OnlyCreated);
         }
         ValuesFile.close ();
       }
@@ -372,67 +1290,77 @@ namespace JCA {
     }
 
     /**
-     * @brief Updates the Links and the Functions
+     * @brief Updates the Links and the Functions in the Order of the Link-Graph.
+     * Holds the UpdateLock, so the Server can read single Functions and Tags from the loop too.
      *
      * @param _Time current Time from RTC
      */
     void FuncHandler::update (struct tm &_Time) {
+      bool Changed = false;
+      {
+        MutexLock Guard (UpdateLock);
+        cycle (_Time);
+
+        // The Handler-Task notifies after its Snapshot
+        if (ChangeCB && !UpdateTask.isRunning ()) {
+          uint32_t Before = ChangeSequence;
+          scanChanges ();
+          Changed = ChangeSequence != Before;
+        }
+      }
+      if (Changed) {
+        ChangeCB ();
+      }
+    }
+
+    /**
+     * @brief One Cycle of the Links and Functions, the Caller holds the UpdateLock
+     *
+     * @param _Time current Time from RTC
+     */
+    void FuncHandler::cycle (struct tm &_Time) {
       Debug.println (FLAG_LOOP, true, Name, __func__, "Run");
-      // Create JsonDoc to hold variant Data
-      JsonDocument LinkDoc;
 
-      // Update Links
-      for (FuncLink *Link : Links) {
+      // Time from Reset to the first Control-Cycle
+      if (FirstCycle) {
+        FirstCycle = false;
+        if (Debug.print (FLAG_SETUP, true, Name, __func__, "First Cycle after Reset [ms] : ")) {
+          Debug.println (FLAG_SETUP, true, Name, __func__, millis ());
+        }
+      }
 
-        switch (Link->Type) {
-        case FuncLinkType_T::LinkDirect:
-          // Direkt Link always read the first Input-Link and set it to all Output-Links
-          if (Link->getInputCount () > 0 && Link->getOutputCount () > 0) {
-            JsonVariant Value = LinkDoc.to<JsonVariant> ();
-            FuncLinkPair_T Input = Link->getInput(0);
-
-            if (Functions[Input.Func]->getTagValueByIndex (Input.Tag, Value)) {
-              for (uint8_t OutputIndex = 0; OutputIndex < Link->getInputCount(); OutputIndex++) {
-                FuncLinkPair_T Output = Link->getOutput (OutputIndex);
-                Functions[Output.Func]->setTagValueByIndex (Output.Tag, Value);
-              }
-            }
-          }
-          break;
+      // Values of the Server are written before the Functions see them
+      CycleWritten = applyCommands ();
 
-        case FuncLinkType_T::LinkMove:
-          // Move Link use the first Input-Link to decide if the second Input-Link should be set to all Output-Link
-          if (Link->getInputCount () > 1 && Link->getOutputCount () > 0) {
-            JsonVariant Value = LinkDoc.to<JsonVariant> ();
-            FuncLinkPair_T Selector = Link->getInput (0);
-            FuncLinkPair_T Input = Link->getInput (1);
-
-            if (Functions[Selector.Func]->getTagValueByIndex (Selector.Tag, Value)) {
-              bool SelectorValue = Value.as<bool> ();
-              if (SelectorValue) {
-                if (Functions[Input.Func]->getTagValueByIndex (Input.Tag, Value)) {
-                  for (uint8_t OutputIndex = 0; OutputIndex < Link->getInputCount (); OutputIndex++) {
-                    FuncLinkPair_T Output = Link->getOutput (OutputIndex);
-                    Functions[Output.Func]->setTagValueByIndex (Output.Tag, Value);
-                  }
-                }
-              }
-            }
-          }
-          break;
+      // Check the Deadlines of Functions with an Update-Period
+      runSchedule ();
 
-        default:
-          break;
+      // Update Functions in Link-Order, each after the Links feeding it
+      for (FuncOrder_T &Entry : Order) {
+        for (FuncLink *Link : Entry.Links) {
+          Link->update ();
+        }
+        if (Entry.Always || Entry.Due) {
+          Entry.Due = false;
+          Functions[Entry.Func]->update (_Time);
         }
       }
+    }
 
-      // Update Functions
-      for (uint16_t i = 0; i < Functions.size (); i++) {
-        Functions[i]->update (_Time);
-      }
+    /**
+     * @brief Set a Callback for changed Tags, e.g. to push them by the Server.
+     * The Tags are scanned after every Cycle, the Callback is called from the Context of update.
+     *
+     * @param _CB Callback, nullptr to disable
+     */
+    void FuncHandler::onChange (std::function<void (void)> _CB) {
+      ChangeCB = _CB;
     }
 
     String FuncHandler::patch(String _Command) {
+      // Never change the Setup during a Cycle of the Handler-Task
+      MutexLock Guard (UpdateLock);
+      MutexLock SetupGuard (SetupLock);
       _Command.toLowerCase ();
       FuncPatchRet_T RetValue = FuncPatchRet_T::modeUndef;
       if (_Command == "saveconfig") {
@@ -452,17 +1380,32 @@ namespace JCA {
           RetValue = setup ();
         }
         if (RetValue > 0) {
-          RetValue = loadValues ();
+          // Kept Functions still have their Values
+          RetValue = loadValues (true);
         }
       } else if (_Command == "delete") {
         RetValue = remove ();
       }
+      if (_Command == "init" || _Command == "reinit" || _Command == "delete") {
+        // Tags are new, the next Scan marks all of them as changed
+        TagVersions.clear ();
+        // Queued Commands address the old Indexes
+        SetupGeneration++;
+      }
       switch (RetValue)
       {
       case FuncPatchRet_T::done:
         return "done";
         break;
 
+      case FuncPatchRet_T::linkCycle:
+        return "linkCycle";
+        break;
+
+      case FuncPatchRet_T::linkCompileFailed:
+        return "linkCompileFailed";
+        break;
+
       case FuncPatchRet_T::linkObjMissing:
         return "linkObjMissing";
         break;
@@ -511,26 +1454,43 @@ namespace JCA {
      * @param _Name Name of the searched Function
      * @return int16_t position of the Function or -1 if not found
      */
-    int16_t FuncHandler::getFuncIndex (String _Name) {
+    int16_t FuncHandler::getFuncIndex (String _Name) const {
+      return getFuncIndex (_Name.c_str ());
+    }
+
+    /**
+     * @brief Returns the position of a Function inside the Functionss-Vector using the Hash-Index.
+     * Only reads the Index, it is changed by setup while patch holds UpdateLock and SetupLock.
+     *
+     * @param _Name Name of the searched Function
+     * @return int16_t position of the Function or -1 if not found
+     */
+    int16_t FuncHandler::getFuncIndex (const char *_Name) const {
+      return FuncIndex.find (_Name);
+    }
+
+    /**
+     * @brief Create the Hash-Index of all Function-Names, after the Functions of a Setup are created
+     */
+    void FuncHandler::buildFuncIndex () {
+      Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
+      FuncIndex.reserve (Functions.size ());
       for (size_t i = 0; i < Functions.size (); i++) {
-        if (Functions[i]->getName () == _Name) {
-          return (int16_t)i;
-        }
+        FuncIndex.add (Functions[i]->getName ().c_str (), i);
       }
-      // Tag was not found
-      return -1;
     }
 
     /**
-     * @brief set Function Date from outside the Handler, by Websocket for example
+     * @brief set Function Values inside the Context of update, the Server uses writeValues
      * 
      * @param _Functions REF to a Values-Object in format like the usrValues.json
+     * @param _OnlyCreated only set Functions (re)created by the last Setup
      */
-    void FuncHandler::setValues( JsonObject &_Functions) {
+    void FuncHandler::setValues (JsonObject &_Functions, bool _OnlyCreated) {
       Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
       for (JsonPair Function : _Functions) {
         int16_t FuncIndex = getFuncIndex (Function.key ().c_str ());
-        if (FuncIndex >= 0) {
+        if (FuncIndex >= 0 && (!_OnlyCreated || FuncCreated[FuncIndex])) {
           JsonObject FuncValues = Function.value ().as<JsonObject> ();
           Functions[FuncIndex]->setValues(FuncValues);
         }
@@ -550,6 +1510,314 @@ namespace JCA {
       }
     }
 
+    /**
+     * @brief Compare the Versions of all Tags with the last Scan and stamp the changed ones with a new Sequence.
+     * If the Tags were changed by a Setup, all of them get the new Sequence.
+     * Must run in the Context of update, because updateVersion compares the Values.
+     */
+    void FuncHandler::scanChanges () {
+      size_t Count = 0;
+      for (JCA::FNC::FuncParent *Function : Functions) {
+        Count += Function->getTagCount ();
+      }
+      uint32_t Next = ChangeSequence + 1;
+      if (TagVersions.size () != Count) {
+        TagVersions.assign (Count, 0);
+        TagSequences.assign (Count, Next);
+        ChangeSequence = Next;
+      }
+      bool Changed = false;
+      size_t Index = 0;
+      for (JCA::FNC::FuncParent *Function : Functions) {
+        for (size_t i = 0; i < Function->getTagCount (); i++, Index++) {
+          TagParent *Tag = Function->getTag (i);
+          Tag->updateVersion ();
+          if (Tag->Version != TagVersions[Index]) {
+            TagVersions[Index] = Tag->Version;
+            TagSequences[Index] = Next;
+            Changed = true;
+          }
+        }
+      }
+      if (Changed) {
+        ChangeSequence = Next;
+      }
+    }
+
+    /**
+     * @brief returns a Values-Object with the Tags changed since a Sequence, Functions without Changes are missing.
+     * The Sequence 0 returns all Tags, without a Scan (may be called outside of update).
+     * The Patterns may contain '*' and '?', nullptr matches all Names.
+     *
+     * @param _Functions REF where the data will returned
+     * @param _Since Sequence returned by the last call, 0 for all Tags
+     * @param _FuncPattern only Functions with a matching Name
+     * @param _TagPattern only Tags with a matching Name
+     * @return uint32_t current Sequence, equal to _Since if no matching Tag was changed
+     */
+    uint32_t FuncHandler::getChangedValues (JsonObject &_Functions, uint32_t _Since, const char *_FuncPattern, const char *_TagPattern) {
+      Debug.println (FLAG_PROTOCOL, true, Name, __func__, "Run");
+      if (_Since == 0 && _FuncPattern == nullptr && _TagPattern == nullptr) {
+        getValues (_Functions);
+        return ChangeSequence;
+      }
+      if (_Since != 0) {
+        scanChanges ();
+        if (ChangeSequence == _Since) {
+          return _Since;
+        }
+      }
+      bool Found = false;
+      size_t Index = 0;
+      for (JCA::FNC::FuncParent *Function : Functions) {
+        size_t Count = Function->getTagCount ();
+        if (!MatchPattern (_FuncPattern, Function->getName ().c_str ())) {
+          Index += Count;
+          continue;
+        }
+        JsonObject Values;
+        for (size_t i = 0; i < Count; i++, Index++) {
+          if (_Since != 0 && TagSequences[Index] <= _Since) {
+            continue;
+          }
+          TagParent *Tag = Function->getTag (i);
+          if (!MatchPattern (_TagPattern, Tag->Name)) {
+            continue;
+          }
+          if (Values.isNull ()) {
+            Values = _Functions[Function->getName ()].to<JsonObject> ();
+          }
+          Tag->addValue (Values);
+          Found = true;
+        }
+      }
+      return (Found || _Since == 0) ? ChangeSequence : _Since;
+    }
+
+    /**
+     * @brief get the Tags changed since a Sequence for the Server, in Task-Mode from the last Snapshot.
+     * Without Task the Tags are scanned directly, with the UpdateLock like update does.
+     *
+     * @param _Functions REF where the data will returned
+     * @param _Since Sequence returned by the last call, 0 for all Tags
+     * @param _FuncPattern only Functions with a matching Name
+     * @param _TagPattern only Tags with a matching Name
+     * @return uint32_t current Sequence, equal to _Since if no matching Tag was changed
+     */
+    uint32_t FuncHandler::readChangedValues (JsonObject &_Functions, uint32_t _Since, const char *_FuncPattern, const char *_TagPattern) {
+      if (!UpdateTask.isRunning ()) {
+        MutexLock Guard (UpdateLock);
+        return getChangedValues (_Functions, _Since, _FuncPattern, _TagPattern);
+      }
+      MutexLock Guard (SnapshotLock);
+      uint32_t Sequence = SnapshotSequence[SnapshotFront];
+      if (_Since == Sequence) {
+        return _Since;
+      }
+      // Every Tag wrote exactly one Value, in the same Order as scanned
+      const std::vector<uint32_t> &Sequences = SnapshotSequences[SnapshotFront];
+      bool Found = false;
+      size_t Index = 0;
+      for (JsonPair Function : Snapshot[SnapshotFront].as<JsonObject> ()) {
+        bool FuncMatch = MatchPattern (_FuncPattern, Function.key ().c_str ());
+        JsonObject Values;
+        for (JsonPair Tag : Function.value ().as<JsonObject> ()) {
+          if (FuncMatch && (_Since == 0 || (Index < Sequences.size () && Sequences[Index] > _Since)) && MatchPattern (_TagPattern, Tag.key ().c_str ())) {
+            if (Values.isNull ()) {
+              Values = _Functions[Function.key ()].to<JsonObject> ();
+            }
+            Values[Tag.key ()] = Tag.value ();
+            Found = true;
+          }
+          Index++;
+        }
+      }
+      return (Found || _Since == 0) ? Sequence : _Since;
+    }
+
+    /**
+     * @brief get the Values of one Function, found by the Hash-Index.
+     * The Tags are read directly between two Cycles, so nothing else is serialized.
+     *
+     * @param _Function Name of the Function
+     * @param _Values REF where the Tag-Values will returned
+     * @return FuncAccessRet_T accessDone or accessFunctionMissing
+     */
+    FuncAccessRet_T FuncHandler::readFunction (const char *_Function, JsonObject &_Values) {
+      MutexLock Guard (UpdateLock);
+      int16_t Func = getFuncIndex (_Function);
+      if (Func < 0) {
+        return FuncAccessRet_T::accessFunctionMissing;
+      }
+      Functions[Func]->addValues (_Values);
+      return FuncAccessRet_T::accessDone;
+    }
+
+    /**
+     * @brief get the Value of one Tag, Function and Tag are found by the Hash-Indices
+     *
+     * @param _Function Name of the Function
+     * @param _Tag Name of the Tag
+     * @param _Values REF where the Tag-Value will returned as key-value-pair
+     * @return FuncAccessRet_T accessDone, accessFunctionMissing or accessTagMissing
+     */
+    FuncAccessRet_T FuncHandler::readTag (const char *_Function, const char *_Tag, JsonObject &_Values) {
+      MutexLock Guard (UpdateLock);
+      int16_t Func = getFuncIndex (_Function);
+      if (Func < 0) {
+        return FuncAccessRet_T::accessFunctionMissing;
+      }
+      TagParent *Tag = Functions[Func]->getTag (Functions[Func]->getTagIndex (_Tag));
+      if (Tag == nullptr) {
+        return FuncAccessRet_T::accessTagMissing;
+      }
+      Tag->addValue (_Values);
+      return FuncAccessRet_T::accessDone;
+    }
+
+    /**
+     * @brief set the Value of one Tag, it is queued and written at the Start of the next Cycle
+     *
+     * @param _Function Name of the Function
+     * @param _Tag Name of the Tag
+     * @param _Value new Value
+     * @return FuncAccessRet_T accessQueued or the Reason why the Value was not queued
+     */
+    FuncAccessRet_T FuncHandler::writeTag (const char *_Function, const char *_Tag, JsonVariant _Value) {
+      MutexLock Guard (SetupLock);
+      int16_t Func = getFuncIndex (_Function);
+      if (Func < 0) {
+        return FuncAccessRet_T::accessFunctionMissing;
+      }
+      return queueValue (Func, Functions[Func]->getTagIndex (_Tag), _Value);
+    }
+
+    /**
+     * @brief Queue the Value of a Tag as Command, the Caller holds the SetupLock.
+     * Values that are no Scalar are stored as JSON, the Command keeps its Place in the Order.
+     * If the Queue is full the Value is rejected and counted.
+     *
+     * @param _Func Index of the Function
+     * @param _Tag Index of the Tag
+     * @param _Value new Value
+     * @return FuncAccessRet_T accessQueued or the Reason why the Value was not queued
+     */
+    FuncAccessRet_T FuncHandler::queueValue (int16_t _Func, int16_t _Tag, JsonVariant _Value) {
+      TagParent *Tag = Functions[_Func]->getTag (_Tag);
+      if (Tag == nullptr) {
+        return FuncAccessRet_T::accessTagMissing;
+      }
+      if (Tag->ReadOnly) {
+        return FuncAccessRet_T::accessReadOnly;
+      }
+      if (_Value.isNull ()) {
+        return FuncAccessRet_T::accessInvalid;
+      }
+      FuncCommand_T Command;
+      Command.Func = _Func;
+      Command.Tag = _Tag;
+      Command.Generation = SetupGeneration;
+      bool Queued;
+      if (_Value.is<bool> ()) {
+        Command.Kind = FuncCommandKind_T::CommandBool;
+        Command.Value.Bool = _Value.as<bool> ();
+        Queued = Commands.push (Command);
+      } else if (_Value.is<int32_t> ()) {
+        Command.Kind = FuncCommandKind_T::CommandInt;
+        Command.Value.Int = _Value.as<int32_t> ();
+        Queued = Commands.push (Command);
+      } else if (_Value.is<uint32_t> ()) {
+        Command.Kind = FuncCommandKind_T::CommandUInt;
+        Command.Value.UInt = _Value.as<uint32_t> ();
+        Queued = Commands.push (Command);
+      } else if (_Value.is<float> ()) {
+        Command.Kind = FuncCommandKind_T::CommandFloat;
+        Command.Value.Float = _Value.as<float> ();
+        Queued = Commands.push (Command);
+      } else if (_Value.is<const char *> () && strlen (_Value.as<const char *> ()) < JCA_IOT_FUNCHANDLER_COMMAND_TEXT) {
+        Command.Kind = FuncCommandKind_T::CommandText;
+        strcpy (Command.Value.Text, _Value.as<const char *> ());
+        Queued = Commands.push (Command);
+      } else {
+        // The Cycle takes the Commands and the Values with the same Lock, so the Positions match
+        MutexLock WriteGuard (WriteLock);
+        Command.Kind = FuncCommandKind_T::CommandJson;
+        Command.Value.Json = WriteQueue.size ();
+        WriteQueue.emplace_back ();
+        WriteQueue.back ().set (_Value);
+        Queued = Commands.push (Command);
+        if (!Queued) {
+          WriteQueue.pop_back ();
+        }
+      }
+      if (!Queued) {
+        Debug.println (FLAG_ERROR, true, Name, __func__, "Command-Queue full, Value rejected");
+        return FuncAccessRet_T::accessQueueFull;
+      }
+      return FuncAccessRet_T::accessQueued;
+    }
+
+    /**
+     * @brief Apply the queued Commands in their Order, only the last Value of each Tag is written.
+     * Commands of an older Setup are dropped. Called by the Cycle with the UpdateLock.
+     *
+     * @return true Values were written
+     */
+    bool FuncHandler::applyCommands () {
+      CommandBatch.clear ();
+      {
+        // All JSON-Commands queued so far are in front of the Queue, so they are taken with their Values
+        MutexLock Guard (WriteLock);
+        FuncCommand_T Command;
+        while (CommandBatch.size () < Commands.capacity () && Commands.pop (Command)) {
+          CommandBatch.push_back (Command);
+        }
+        WriteBatch.swap (WriteQueue);
+      }
+      if (CommandBatch.empty ()) {
+        return false;
+      }
+      for (size_t i = 0; i < CommandBatch.size (); i++) {
+        FuncCommand_T &Entry = CommandBatch[i];
+        if (Entry.Generation != SetupGeneration || Entry.Func >= (int16_t)Functions.size ()) {
+          continue;
+        }
+        // A later Command overwrites the same Tag, the Batch is as small as the Queue
+        bool Overwritten = false;
+        for (size_t j = i + 1; j < CommandBatch.size () && !Overwritten; j++) {
+          Overwritten = CommandBatch[j].Func == Entry.Func && CommandBatch[j].Tag == Entry.Tag;
+        }
+        if (Overwritten) {
+          continue;
+        }
+        switch (Entry.Kind) {
+        case FuncCommandKind_T::CommandBool:
+          CommandValue.set (Entry.Value.Bool);
+          break;
+        case FuncCommandKind_T::CommandInt:
+          CommandValue.set (Entry.Value.Int);
+          break;
+        case FuncCommandKind_T::CommandUInt:
+          CommandValue.set (Entry.Value.UInt);
+          break;
+        case FuncCommandKind_T::CommandFloat:
+          CommandValue.set (Entry.Value.Float);
+          break;
+        case FuncCommandKind_T::CommandJson:
+          if (Entry.Value.Json < WriteBatch.size ()) {
+            Functions[Entry.Func]->setTagValueByIndex (Entry.Tag, WriteBatch[Entry.Value.Json].as<JsonVariant> ());
+          }
+          continue;
+        default:
+          CommandValue.set ((const char *)Entry.Value.Text);
+          break;
+        }
+        Functions[Entry.Func]->setTagValueByIndex (Entry.Tag, CommandValue.as<JsonVariant> ());
+      }
+      WriteBatch.clear ();
+      return true;
+    }
+
     /**
      * @brief get the Amount of Links in the Links-Vector
      * 
@@ -567,5 +1835,120 @@ namespace JCA {
     int16_t FuncHandler::getFuncCount () {
       return Functions.size ();
     }
+    /**
+     * @brief Run the Handler in an own Task with a fixed Period (ESP32: pinned to a Core).
+     * The Server must use readValues and writeValues afterwards, patch waits for the end of a Cycle.
+     *
+     * @param _Period Period of the Cycle in [ms]
+     * @param _Time Callback to get the current Time for each Cycle
+     * @param _Core CPU-Core of the Task (ESP32 only)
+     * @return true Task is running
+     * @return false no Task-Backend (ESP8266), update must be called by loop
+     */
+    bool FuncHandler::startTask (uint32_t _Period, std::function<void (struct tm &)> _Time, uint8_t _Core) {
+      Debug.println (FLAG_SETUP, true, Name, __func__, "Run");
+      TaskTime = _Time;
+      {
+        MutexLock Guard (UpdateLock);
+        takeSnapshot ();
+      }
+      bool Done = UpdateTask.start (Name.c_str (), _Period, [this] () { taskCycle (); }, _Core);
+      if (!Done) {
+        Debug.println (FLAG_ERROR, true, Name, __func__, "Task not started, update by loop");
+      }
+      return Done;
+    }
+
+    /**
+     * @brief Stop the Handler-Task, the queued Values are written by the last Cycle
+     */
+    void FuncHandler::stopTask () {
+      UpdateTask.stop ();
+    }
+
+    /**
+     * @brief One Cycle of the Handler-Task: update (with the queued Values) and refresh the Snapshot
+     */
+    void FuncHandler::taskCycle () {
+      struct tm Time;
+      TaskTime (Time);
+      bool Changed = false;
+      {
+        MutexLock Guard (UpdateLock);
+        cycle (Time);
+        bool Written = CycleWritten;
+
+        // With a Change-Callback the Snapshot follows every Change, so the Server can push it at once
+        uint32_t Before = SnapshotSequence[SnapshotFront];
+        if (Written || millis () - SnapshotMillis >= JCA_IOT_FUNCHANDLER_SNAPSHOT_PERIOD) {
+          takeSnapshot ();
+        } else if (ChangeCB) {
+          uint32_t Scanned = ChangeSequence;
+          scanChanges ();
+          if (ChangeSequence != Scanned) {
+            takeSnapshot ();
+          }
+        }
+        Changed = SnapshotSequence[SnapshotFront] != Before;
+      }
+      // The Callback may read the Handler, so the Lock is released before
+      if (ChangeCB && Changed) {
+        ChangeCB ();
+      }
+    }
+
+    /**
+     * @brief Fill the back Snapshot and make it the front one.
+     * Readers copy the front Snapshot while holding the Lock, so nobody reads the back one.
+     */
+    void FuncHandler::takeSnapshot () {
+      SnapshotMillis = millis ();
+      uint8_t Back = SnapshotFront ^ 1;
+      scanChanges ();
+      SnapshotSequences[Back] = TagSequences;
+      SnapshotSequence[Back] = ChangeSequence;
+      Snapshot[Back].clear ();
+      JsonObject Values = Snapshot[Back].to<JsonObject> ();
+      getValues (Values);
+      MutexLock Guard (SnapshotLock);
+      SnapshotFront = Back;
+    }
+
+    /**
+     * @brief set Function Values from the Server, they are queued and written at the Start of the next Cycle.
+     * Unknown Functions and Tags are ignored.
+     *
+     * @param _Functions REF to a Values-Object in format like the usrValues.json
+     */
+    void FuncHandler::writeValues (JsonObject &_Functions) {
+      MutexLock Guard (SetupLock);
+      for (JsonPair Function : _Functions) {
+        int16_t Func = getFuncIndex (Function.key ().c_str ());
+        if (Func < 0 || !Function.value ().is<JsonObject> ()) {
+          continue;
+        }
+        for (JsonPair Tag : Function.value ().as<JsonObject> ()) {
+          queueValue (Func, Functions[Func]->getTagIndex (Tag.key ().c_str ()), Tag.value ());
+        }
+      }
+    }
+
+    /**
+     * @brief get the Function Values for the Server, in Task-Mode from the last Snapshot.
+     * Without Task the Tags are read directly, with the UpdateLock like update does.
+     *
+     * @param _Functions REF where the data will returned
+     */
+    void FuncHandler::readValues (JsonObject &_Functions) {
+      if (!UpdateTask.isRunning ()) {
+        MutexLock Guard (UpdateLock);
+        getValues (_Functions);
+        return;
+      }
+      MutexLock Guard (SnapshotLock);
+      for (JsonPair Function : Snapshot[SnapshotFront].as<JsonObject> ()) {
+        _Functions[Function.key ()] = Function.value ();
+      }
+    }
   }
 }
\ No newline at end of file
@@ -2,11 +2,29 @@
  * @file JCA_IOT_Handler.h
  * @author JCA (https://github.com/ichok)
  * @brief Handling class to create an handle functions.
- * @version 1.1
+ * @version 1.19
  * @date 2024-04-21
  * @changelog
  * - 1.0 2024-04-21: Initial version
  * - 1.1 2024-04-21: Added new Link-Type Move
+ * - 1.2 2026-10-17: Links are compiled to typed copy functions, no JSON inside the loop
+ * - 1.3 2026-10-17: Functions are updated in the order of the link graph
+ * - 1.4 2026-10-17: Hash-Index for Function-Names
+ * - 1.5 2026-10-17: Deadline-Scheduler for Functions with an Update-Period
+ * - 1.6 2026-10-17: Links only propagate if the Version of the Source was changed
+ * - 1.7 2026-10-17: Added new Link-Type Formula
+ * - 1.8 2026-10-17: Setup keeps unchanged Functions, only changed ones are recreated
+ * - 1.9 2026-10-17: Setup-File is read element by element, Log-File is written incrementally
+ * - 1.10 2026-10-17: Compiled binary Cache of the Setup for a fast Boot
+ * - 1.11 2026-10-17: Optional own Task with Value-Snapshot and Write-Queue for the Server
+ * - 1.12 2026-10-17: Functions, Tags and Links are allocated inside the Object-Arena
+ * - 1.13 2026-10-17: Change-Sequence of all Tags, to read only the Values changed since a Sequence
+ * - 1.14 2026-10-17: Functions-File is streamed by the JsonWriter
+ * - 1.15 2026-10-17: Read and write single Functions and Tags by the Hash-Index
+ * - 1.16 2026-10-17: Changed Values can be filtered by Patterns of Function- and Tag-Names
+ * - 1.17 2026-10-17: Optional Change-Callback after a Cycle that changed Tags
+ * - 1.18 2026-10-17: Writes from the Server are queued as typed Commands and applied at the Start of a Cycle
+ * - 1.19 2026-10-17: Values-Files are read and written with a Document of the DocPool
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -19,6 +37,8 @@
 #include <ArduinoJson.h>
 #include <FS.h>
 #include <LittleFS.h>
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -31,9 +51,18 @@
 #endif
 
 #include <JCA_FNC_Parent.h>
+#include <JCA_SYS_Conversion.h>
 #include <JCA_SYS_DebugOut.h>
+#include <JCA_SYS_DocPool.h>
+#include <JCA_SYS_Expression.h>
+#include <JCA_SYS_NameIndex.h>
+#include <JCA_SYS_RingQueue.h>
+#include <JCA_SYS_Task.h>
 
 #define JCA_IOT_FUNCHANDLER_SETUP_NAME "name"
+#define JCA_IOT_FUNCHANDLER_SETUP_PERIOD "period"
+#define JCA_IOT_FUNCHANDLER_SETUP_PHASE "phase"
+#define JCA_IOT_FUNCHANDLER_SETUP_EXPR "expr"
 // JSON Files used Functionhandler for Config and Data-Storage, only if not defines in main.cpp or somewhere else
 #ifndef JCA_IOT_FILE_SETUP
   #define JCA_IOT_FILE_SETUP "/usrSetup.json"
@@ -47,6 +76,21 @@
 #ifndef JCA_IOT_FILE_LOG
   #define JCA_IOT_FILE_LOG "/usrLog.json"
 #endif
+#ifndef JCA_IOT_FILE_CACHE
+  #define JCA_IOT_FILE_CACHE "/usrSetup.bin"
+#endif
+// Period of the Snapshot for the Server, if the Handler runs in its own Task
+#ifndef JCA_IOT_FUNCHANDLER_SNAPSHOT_PERIOD
+  #define JCA_IOT_FUNCHANDLER_SNAPSHOT_PERIOD 100
+#endif
+// Commands written by the Server, applied at the Start of the next Cycle
+#ifndef JCA_IOT_FUNCHANDLER_COMMAND_QUEUE
+  #define JCA_IOT_FUNCHANDLER_COMMAND_QUEUE 64
+#endif
+// Longer Strings, Arrays and Objects are stored as JSON, the Command only holds their Position
+#define JCA_IOT_FUNCHANDLER_COMMAND_TEXT 24
+// First Word of the Cache-File, change it if the Cache-Layout changes
+#define JCA_IOT_FUNCHANDLER_CACHE_MAGIC 0x3346434AUL
 
 namespace JCA {
   namespace IOT {
@@ -54,13 +98,39 @@ namespace JCA {
       int16_t Func;
       int16_t Tag;
     };
+    class FuncLink;
+    struct FuncOrder_T {
+      int16_t Func;
+      std::vector<FuncLink *> Links; ///< Links to execute right before the Function
+      bool Always;                   ///< Function without Update-Period, update every loop
+      bool Due;                      ///< Set by the Scheduler if the Update-Period is elapsed
+    };
+    struct FuncSchedule_T {
+      unsigned long Deadline;
+      uint32_t Period;
+      int16_t Order; ///< Position inside the Order-Vector
+    };
+    struct FuncSetupKey_T {
+      uint32_t Hash;   ///< FNV-1a of the serialized Setup-Object
+      uint32_t Crc;    ///< CRC-32 of the same Text, a second independent Hash
+      uint32_t Length; ///< Length of the Text
+      bool operator== (const FuncSetupKey_T &_Other) const { return Hash == _Other.Hash && Crc == _Other.Crc && Length == _Other.Length; };
+    };
+    struct FuncLinkTag_T {
+      JCA::TAG::TagParent *Tag;
+      JCA::TAG::TagCopyFunction Copy;
+      uint32_t Version; ///< Version of the last propagation, only used for Formula-Operands
+    };
     enum FuncLinkType_T : uint8_t {
       LinkNone = 0,
       LinkDirect = 1,
-      LinkMove = 2
+      LinkMove = 2,
+      LinkFormula = 3
     };
     enum FuncPatchRet_T : int8_t {
       done = 127,
+      linkCycle = 50,
+      linkCompileFailed = 40,
       linkObjMissing = 35,
       linkTypMissing = 30,
       hardwareMissing = 20,
@@ -71,23 +141,78 @@ namespace JCA {
       modeUndef = -4,
       failed = -99
     };
+    enum FuncAccessRet_T : uint8_t {
+      accessDone = 0,
+      accessFunctionMissing = 1,
+      accessTagMissing = 2,
+      accessReadOnly = 3,
+      accessInvalid = 4,
+      accessQueued = 5,
+      accessQueueFull = 6
+    };
+    enum FuncCommandKind_T : uint8_t {
+      CommandBool = 0,
+      CommandInt = 1,
+      CommandUInt = 2,
+      CommandFloat = 3,
+      CommandText = 4,
+      CommandJson = 5
+    };
+    struct FuncCommand_T {
+      int16_t Func;
+      int16_t Tag;
+      uint16_t Generation; ///< Setup-Generation the Indexes belong to
+      FuncCommandKind_T Kind;
+      union {
+        bool Bool;
+        int32_t Int;
+        uint32_t UInt;
+        float Float;
+        char Text[JCA_IOT_FUNCHANDLER_COMMAND_TEXT];
+        uint16_t Json; ///< Position of the Value inside the WriteQueue
+      } Value;
+    };
     
     class FuncLink {
     private:
       std::vector<FuncLinkPair_T> Input;
       std::vector<FuncLinkPair_T> Output;
 
+      // Resolved Tags, created by compile
+      JCA::TAG::TagParent *Selector;
+      JCA::TAG::TagCopyFunction SelectorCopy;
+      JCA::TAG::TagParent *Source;
+      std::vector<FuncLinkTag_T> Targets;
+
+      // Formula, all Inputs are Operands converted to float
+      String Expr;
+      JCA::SYS::Expression Formula;
+      std::vector<FuncLinkTag_T> Operands;
+      std::vector<float> OperandValues;
+      float Result;
+
+      // Versions of the last propagation
+      bool Propagated;
+      uint32_t SelectorVersion;
+      uint32_t SourceVersion;
+
     public:
       FuncLinkType_T Type;
 
       FuncLink(FuncLinkType_T _Type);
       ~FuncLink();
+      static void *operator new (size_t _Size) { return JCA::SYS::Arena::Objects.allocate (_Size); };
+      static void operator delete (void *_Ptr) { JCA::SYS::Arena::release (_Ptr); };
       void addInput(FuncLinkPair_T _Input);
       void addOutput(FuncLinkPair_T _Output);
       FuncLinkPair_T getInput(uint8_t _Index);
       FuncLinkPair_T getOutput(uint8_t _Index);
       uint8_t getInputCount() { return Input.size(); };
       uint8_t getOutputCount() { return Output.size(); };
+      void setExpression (const char *_Expr);
+      const String &getExpression () { return Expr; };
+      bool compile (std::vector<JCA::FNC::FuncParent *> &_Functions, JsonObject _Log);
+      void update ();
     };
 
     class FuncHandler {
@@ -100,19 +225,70 @@ namespace JCA {
 
       // LoopData
       unsigned long LastUpdate;
+      bool FirstCycle;
+
+      // Task-Mode, the Server only sees the Snapshot and writes through the Queue
+      JCA::SYS::Task UpdateTask;
+      JCA::SYS::Mutex UpdateLock;   ///< Held during a Cycle and by patch
+      std::function<void (struct tm &)> TaskTime;
+      JsonDocument Snapshot[2];
+      uint8_t SnapshotFront;        ///< Index of the Snapshot the Server reads
+      unsigned long SnapshotMillis;
+      JCA::SYS::Mutex SnapshotLock;
+      std::vector<JsonDocument> WriteQueue; ///< Values of the JSON-Commands, never more than the Command-Queue holds
+      std::vector<JsonDocument> WriteBatch; ///< Queue moved out by the Cycle, keeps the Capacity
+      JCA::SYS::Mutex WriteLock;            ///< Held while a JSON-Command is queued and while the Cycle takes the Commands
+      void cycle (struct tm &_Time);
+      void taskCycle ();
+      void takeSnapshot ();
+
+      // Changes of the Tags, all Tags of all Functions in a row
+      uint32_t ChangeSequence;            ///< Moves on every Scan that found a changed Tag
+      std::vector<uint32_t> TagVersions;  ///< Version of each Tag at the last Scan
+      std::vector<uint32_t> TagSequences; ///< ChangeSequence of the last Change of each Tag
+      std::vector<uint32_t> SnapshotSequences[2];
+      uint32_t SnapshotSequence[2];
+      void scanChanges ();
+
+      // Commands of the Server, resolved to Indexes by the Server-Task and applied by update
+      JCA::SYS::RingQueue<FuncCommand_T, JCA_IOT_FUNCHANDLER_COMMAND_QUEUE> Commands;
+      std::vector<FuncCommand_T> CommandBatch;
+      JsonDocument CommandValue;  ///< Value of the applied Command as Variant for the Tag
+      JCA::SYS::Mutex SetupLock;  ///< Held by patch and while Names are resolved to Indexes
+      uint16_t SetupGeneration;   ///< Moves on every Setup, older Commands are dropped
+      bool CycleWritten;          ///< The last Cycle applied Commands
+      FuncAccessRet_T queueValue (int16_t _Func, int16_t _Tag, JsonVariant _Value);
+      bool applyCommands ();
+      std::function<void (void)> ChangeCB; ///< Called after a Cycle that changed Tags, scans every Cycle if set
 
       // Controller Setup
       std::vector<FuncLink *> Links;
       std::map<String, FuncLinkType_T> LinkMapping;
+      std::vector<FuncOrder_T> Order;
+      std::vector<FuncSchedule_T> Schedule; ///< Min-Heap of the next Deadlines
+      JCA::SYS::NameIndex FuncIndex;
+      std::vector<FuncSetupKey_T> FuncSetupKey; ///< Fingerprint of the Setup-Object of each Function, to find unchanged ones
+      std::vector<bool> FuncCreated;       ///< Function was (re)created by the last Setup
+      void buildFuncIndex ();
 
       bool checkLink (String _FuncName, int16_t &_Func, String _TagName, int16_t &_Tag, JsonArray _LogArray);
+      bool readSetupArray (File &_Setup, const char *_Key, File &_Log, bool *_LogFirst, std::function<void (JsonObject, JsonObject)> _Element, FuncPatchRet_T &_RetValue);
       void deleteLinks();
+      FuncPatchRet_T buildOrder (JsonObject _Log);
+      void buildSchedule (JsonArray _Log);
+      void runSchedule ();
       void deleteFunctions();
+      bool createFunction (JsonObject _Setup, JsonObject _Log);
+      static uint32_t firmwareId ();
+      static uint32_t hashTagLayout (JCA::FNC::FuncParent *_Function);
+      uint32_t hashSetupFile ();
+      FuncPatchRet_T saveCache (uint32_t _SourceHash);
+      bool loadCache (uint32_t _SourceHash, File &_Log, bool &_LogFirst);
       FuncPatchRet_T setup ();
       FuncPatchRet_T remove ();
       FuncPatchRet_T saveFunctions ();
       FuncPatchRet_T saveValues ();
-      FuncPatchRet_T loadValues ();
+      FuncPatchRet_T loadValues (bool _OnlyCreated = false);
 
     public:
       // Map with the initialisation callbacks for all functions
@@ -125,10 +301,24 @@ namespace JCA {
       void update (struct tm &_Time);
       String patch(String _Command);
 
-      int16_t getFuncIndex (String _Name);
-      void setValues (JsonObject &_Functions);
+      int16_t getFuncIndex (String _Name) const;
+      int16_t getFuncIndex (const char *_Name) const;
+      void setValues (JsonObject &_Functions, bool _OnlyCreated = false);
+      void writeValues (JsonObject &_Functions);
+      void readValues (JsonObject &_Functions);
+      void onChange (std::function<void (void)> _CB);
+      bool startTask (uint32_t _Period, std::function<void (struct tm &)> _Time, uint8_t _Core = 1);
+      void stopTask ();
+      bool isTaskRunning () { return UpdateTask.isRunning (); };
+      JCA::SYS::Task &getTask () { return UpdateTask; };
       void getValues (JsonObject &_Functions);
+      uint32_t getChangedValues (JsonObject &_Functions, uint32_t _Since, const char *_FuncPattern = nullptr, const char *_TagPattern = nullptr);
+      uint32_t readChangedValues (JsonObject &_Functions, uint32_t _Since, const char *_FuncPattern = nullptr, const char *_TagPattern = nullptr);
+      FuncAccessRet_T readFunction (const char *_Function, JsonObject &_Values);
+      FuncAccessRet_T readTag (const char *_Function, const char *_Tag, JsonObject &_Values);
+      FuncAccessRet_T writeTag (const char *_Function, const char *_Tag, JsonVariant _Value);
       int16_t getLinkCount();
+      uint32_t getCommandsRejected () { return Commands.getDropped (); }; ///< Writes rejected because the Command-Queue was full
       int16_t getFuncCount();
     };
   }
@@ -19,15 +19,42 @@
  *   - Websockt use RestAPI Callback-Functions for Events if no other is defined
  *     - onWsEvent : Default = onRestApiPost
  *     - onWsUpdate : Default = onRestApiGet
+ *       gets the Sequence of the last Update as "since" (0 = all Data) and returns the new one as "seq",
+ *       a Client only gets an Update if the Sequence was moved
+ *   - Clients sending binary Messages or {"format":"msgpack"} get MessagePack
+ *   - Clients can subscribe to Function/Tag-Patterns with an own Interval, they get only these Updates:
+ *     {"subscribe":[{"function":"PID*","tag":"Process*","interval":100},{"interval":10000}]}
+ *     missing Patterns match all Names, an empty List returns to the common Update
+ *   - Messages up to JCA_IOT_SERVER_WS_RX_MAX Bytes are accepted, single Frames are parsed without a Copy
+ *   - notifyChange schedules a Push of the Changes after a short Coalescing-Window,
+ *     each Client gets at most one Push per WsPushInterval (0 = only the periodic Update)
+ * - RestAPI answers in MessagePack for "Accept: application/msgpack" and reads MessagePack Bodies
+ * - RestAPI-Paths /api/<function> (GET) and /api/<function>/<tag> (GET, PUT with the Value as Body)
+ *   are passed to onRestApiPathGet / onRestApiPathPut, the Callback returns the HTTP-Status
+ * - RestAPI-Responses are serialized in Parts while the Connection takes them, the Memory does not grow with the Response
+ * - New Clients share one serialized Snapshot of the Update-Callback (since = 0),
+ *   it is rebuilt only after the Sequence was moved or a Request wrote Data
+ * - RestAPI-GET without Body shares one serialized Answer of the GET-Callback until notifyChange or a Request
+ *   that wrote Data, without Notifications every GET builds its own Answer
  * - UdpListener
  *   - Listen to UDP-Packets in JSON for Timesync and maybe more some times
  * - LocaltimeZone
  *   - Get Epoch of local Timezone with Daylight Saving Time
- * @version 1.0
+ * @version 1.10
  * @date 2022-09-04
  * @changelog
  * - [0.1] 2022-09-04: First Version
  * - [1.0] 2025-04-12: UdpListener added, Localtime Zone added
+ * - [1.1] 2026-10-17: WebSocket sends only the Changes since the last Update of each Client
+ * - [1.2] 2026-10-17: MessagePack as optional Wire-Format for RestAPI and WebSocket
+ * - [1.3] 2026-10-17: Serialize-once Snapshot and shared WebSocket-Buffers
+ * - [1.4] 2026-10-17: Path-addressed RestAPI for single Functions and Tags
+ * - [1.5] 2026-10-17: WebSocket-Subscriptions with Patterns and Interval
+ * - [1.6] 2026-10-17: Event-driven Push of Changes
+ * - [1.7] 2026-10-17: Reusable Receive-Buffer per WebSocket-Client
+ * - [1.8] 2026-10-17: Request-Documents are borrowed from JCA::SYS::DocPool::Requests
+ * - [1.9] 2026-10-17: RestAPI-Responses are serialized Part by Part, without a Buffer of the whole Response
+ * - [1.10] 2026-10-17: Web-Content with Cache-Validators, Framework-Sites pre-compressed in PROGMEM
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -37,6 +64,11 @@
 #define _JCA_IOT_SERVER_
 #include "FS.h"
 #include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
 #include <ArduinoJson.h>
 
 #ifdef ESP32
@@ -74,7 +106,12 @@
 #include <JCA_IOT_Server_WebSVGs.h>
 #include <JCA_IOT_Server_WebSites.h>
 #include <JCA_IOT_WiFiConnect.h>
+#include <JCA_SYS_Conversion.h>
 #include <JCA_SYS_DebugOut.h>
+#include <JCA_SYS_DocPool.h>
+#include <JCA_SYS_JsonParts.h>
+#include <JCA_SYS_NameIndex.h>
+#include <JCA_SYS_Task.h>
 
 // Manual setting Firmware withpout Git
 #ifndef AUTO_VERSION
@@ -115,6 +152,31 @@
 #define JCA_IOT_SERVER_CONFKEY_REBOOTCOUNTER "rebootCounter"
 // JSON Keys for Web-Socket Config
 #define JCA_IOT_SERVER_CONFKEY_SOCKETUPDATE "wsUpdate"
+#define JCA_IOT_SERVER_CONFKEY_SOCKETPUSH "wsPush"
+// JSON Keys between Web-Socket and Update-Callback
+#define JCA_IOT_SERVER_WS_SINCE "since"
+#define JCA_IOT_SERVER_WS_SEQUENCE "seq"
+// Wire-Format, JSON is the default
+#define JCA_IOT_SERVER_WS_FORMAT "format"
+#define JCA_IOT_SERVER_WS_FORMAT_MSGPACK "msgpack"
+#define JCA_IOT_SERVER_MIME_JSON "application/json"
+#define JCA_IOT_SERVER_MIME_MSGPACK "application/msgpack"
+// Subscriptions, the Patterns are passed to the Update-Callback
+#define JCA_IOT_SERVER_WS_SUBSCRIBE "subscribe"
+#define JCA_IOT_SERVER_WS_FUNCTION "function"
+#define JCA_IOT_SERVER_WS_TAG "tag"
+#define JCA_IOT_SERVER_WS_INTERVAL "interval"
+#define JCA_IOT_SERVER_WS_MIN_INTERVAL 50
+#define JCA_IOT_SERVER_WS_MAX_SUBSCRIPTIONS 8
+// Event-driven Push, Notifications within the Window are sent together
+#define JCA_IOT_SERVER_WS_COALESCE 20
+// Receive-Buffer of each Client, reserved on Connect and grown up to the Maximum
+#ifndef JCA_IOT_SERVER_WS_RX_SIZE
+  #define JCA_IOT_SERVER_WS_RX_SIZE 256
+#endif
+#ifndef JCA_IOT_SERVER_WS_RX_MAX
+  #define JCA_IOT_SERVER_WS_RX_MAX 4096
+#endif
 // Website Config
 #define JCA_IOT_SERVER_PATH_CONNECT "/connect"
 #define JCA_IOT_SERVER_PATH_SYS "/sys"
@@ -124,6 +186,11 @@
 #define JCA_IOT_SERVER_PATH_HOME "/home.htm"
 #define JCA_IOT_SERVER_PATH_CONFIG "/config.htm"
 #define JCA_IOT_SERVER_PATH_CONFIGSAVE "/configSave"
+#define JCA_IOT_SERVER_PATH_API "/api"
+// Cache-Control of the Web-Content from LittleFS, the Browser revalidates with ETag and Last-Modified
+#ifndef JCA_IOT_SERVER_CACHE_CONTROL
+  #define JCA_IOT_SERVER_CACHE_CONTROL "no-cache"
+#endif
 // Time settings
 #define JCA_IOT_SERVER_TIME_OFFSET 3600
 #define JCA_IOT_SERVER_TIME_VALID 1609459200
@@ -135,6 +202,7 @@ namespace JCA {
   namespace IOT {
     typedef std::function<void (JsonVariant &_In, JsonVariant &_Out)> JsonVariantCallback;
     typedef std::function<void (void)> SimpleCallback;
+    typedef std::function<int (const String &_Function, const String &_Tag, JsonVariant &_In, JsonVariant &_Out)> RestApiPathCallback;
 
     class Server {
     private:
@@ -151,11 +219,18 @@ namespace JCA {
       AsyncUDP UpdListenerObject;
       ESP32Time Rtc;
       String WebConfigFile;
+      AsyncStaticWebHandler *WebContent;
+      uint32_t WebContentStamp;             ///< Hash the Last-Modified of the Web-Content was set from
+      uint32_t WebContentHash;              ///< Hash of the current Files, taken over by the Filter
+      JCA::SYS::Mutex WebContentLock;
+      std::atomic<bool> WebContentChanged;  ///< A File was uploaded, the Hash is rebuilt by handle
 
       SimpleCallback onSystemResetCB;
       SimpleCallback onSaveConfigCB;
       bool readConfig ();
       int getLastSunday(int _Year, int _Month);
+      void hashWebContent ();
+      bool filterWebContent (AsyncWebServerRequest *_Request);
 
       // ...UdpListener.cpp
       void udpPacketHandler (AsyncUDPPacket _Packet);
@@ -177,6 +252,8 @@ namespace JCA {
       String replaceConfigWildcards (const String &var);
       String replaceSystemWildcards (const String &var);
       String replaceConnectWildcards (const String &var);
+      static bool acceptsGzip (AsyncWebServerRequest *_Request);
+      void sendGzPage (AsyncWebServerRequest *_Request, const WebGzPage_T &_Page, AwsTemplateProcessor _Replace);
 
       // ...Webserver_RestApi.cpp
       JsonVariantCallback restApiGetCB;
@@ -184,15 +261,81 @@ namespace JCA {
       JsonVariantCallback restApiPutCB;
       JsonVariantCallback restApiPatchCB;
       JsonVariantCallback restApiDeleteCB;
+      RestApiPathCallback restApiPathGetCB;
+      RestApiPathCallback restApiPathPutCB;
       void onRestApiRequest (AsyncWebServerRequest *_Request, JsonVariant &_Json);
+      void onRestApiBody (AsyncWebServerRequest *_Request);
+      void onRestApiPath (AsyncWebServerRequest *_Request, const String &_Path, JsonVariant &_Json, bool _MsgPack);
+      void restApiSend (AsyncWebServerRequest *_Request, int _Code, JCA::SYS::PooledDoc &_Doc, bool _MsgPack);
+      void restApiSend (AsyncWebServerRequest *_Request, int _Code, std::shared_ptr<void> _Owner, JsonVariantConst _Data, bool _MsgPack);
+      std::shared_ptr<JsonDocument> getRestSnapshot ();
 
       // ...Webserver_Socket.cpp
       unsigned long WsLastUpdate;
+      unsigned long WsLastSubscriptions;
+      std::atomic<bool> WsPushPending; ///< Set with WsPushLock, read without it to skip the Lock in the Loop
+      unsigned long WsPushMillis;      ///< Time of the first Notification of the pending Push
+      uint32_t WsPushDelay;            ///< Coalescing-Window, or the Time until a deferred Client is allowed again
+      JCA::SYS::Mutex WsPushLock;      ///< Notifications come from other Tasks, e.g. the Function-Handler
+      void wsSchedulePush (unsigned long _Millis, uint32_t _Delay);
+      bool wsPushDue (unsigned long _Millis);
       JsonVariantCallback wsDataCB;
       JsonVariantCallback wsUpdateCB;
+      struct WsSubscription_T {
+        String Function;          ///< Pattern of the Function-Names, empty for all
+        String Tag;               ///< Pattern of the Tag-Names, empty for all
+        uint32_t Interval;        ///< minimum Time between two Updates in [ms]
+        uint32_t Sequence;        ///< Sequence of the last Update of this Subscription
+        unsigned long LastMillis; ///< Time of the last Check
+      };
+      struct WsClient_T {
+        uint32_t Sequence; ///< Sequence of the last Update sent to the Client
+        bool MsgPack;      ///< Client uses MessagePack instead of JSON
+        std::vector<WsSubscription_T> Subscriptions; ///< empty for the common Update
+        unsigned long LastMillis; ///< Time of the last Message, for the Rate-Limit of the Push
+        std::vector<uint8_t> RxBuffer; ///< Fragmented Message, the Capacity is kept for the next one
+        bool RxDrop;                   ///< Message too long, the remaining Frames are ignored
+      };
+      std::map<uint32_t, WsClient_T> WsClients; ///< State of each Client-ID
+      JCA::SYS::Mutex WsClientLock;
+      struct WsMessage_T {
+        AsyncWebSocketSharedBuffer Json; ///< nullptr until a Client needs JSON
+        AsyncWebSocketSharedBuffer Pack; ///< nullptr until a Client needs MessagePack
+      };
+      struct Snapshot_T {
+        bool Valid;
+        uint32_t Sequence; ///< Sequence of the Data, 0 if the Callback has no Sequences
+        JsonDocument Data;
+        WsMessage_T Message;
+      };
+      Snapshot_T Snapshot;     ///< All Data, shared by new Clients
+      std::shared_ptr<JsonDocument> RestSnapshot; ///< Answer of the GET-Callback, shared by RestAPI-GET without Body, nullptr if outdated
+      bool ChangeNotified;                        ///< notifyChange was called, the RestSnapshot is kept until the next one
+      struct WsBuild_T {
+        bool Built = false;
+        bool Changed = false;
+        uint32_t Since = 0;    ///< Sequence the Changes are built for
+        uint32_t Sequence = 0; ///< Sequence after the Changes
+        JCA::SYS::PooledDoc Data {JCA::SYS::DocPool::Requests};
+        WsMessage_T Message;
+      };
+      JCA::SYS::Mutex SnapshotLock;
       void onWsEvent (AsyncWebSocket *_Server, AsyncWebSocketClient *_Client, AwsEventType _Type, void *_Arg, uint8_t *_Data, size_t _Len);
       void wsHandleData (AsyncWebSocketClient *_Client, void *_Arg, uint8_t *_Data, size_t _Len);
+      void wsHandleMessage (AsyncWebSocketClient *_Client, JsonDocument &_InDoc, bool _MsgPack);
+      static DeserializationError wsParse (JsonDocument &_Doc, const uint8_t *_Data, size_t _Len, bool _MsgPack);
+      static AsyncWebSocketSharedBuffer serializeShared (JsonVariantConst _Data, bool _MsgPack);
+      void wsSend (AsyncWebSocketClient *_Client, bool _MsgPack, JsonVariantConst _Data, WsMessage_T &_Message);
+      bool buildWsUpdate (uint32_t _Since, JsonDocument &_Data, uint32_t &_Sequence, const char *_Function = nullptr, const char *_Tag = nullptr);
       bool doWsUpdate (AsyncWebSocketClient *_Client);
+      bool doWsPush ();
+      void wsCheckSnapshot (WsBuild_T &_Build);
+      bool wsSendChanges (WsBuild_T &_Build, bool _Push);
+      bool wsSubscribe (WsClient_T &_Client, JsonArray _Subscriptions);
+      bool doWsSubscriptions ();
+      static void mergeJson (JsonVariant _Target, JsonVariantConst _Source);
+      AsyncWebSocketSharedBuffer getSnapshot (bool _MsgPack, uint32_t &_Sequence);
+      void invalidateSnapshot ();
 
     public:
       // ...Webserver_System.cpp
@@ -237,9 +380,13 @@ namespace JCA {
       void onRestApiPut (JsonVariantCallback _CB);
       void onRestApiPatch (JsonVariantCallback _CB);
       void onRestApiDelete (JsonVariantCallback _CB);
+      void onRestApiPathGet (RestApiPathCallback _CB);
+      void onRestApiPathPut (RestApiPathCallback _CB);
 
       // ...Webserver_Socket.cpp
       uint32_t WsUpdateCycle;
+      uint32_t WsPushInterval; ///< minimum Time between two Pushes to a Client in [ms], 0 = no Push
+      void notifyChange ();
       void onWsData (JsonVariantCallback _CB);
       void onWsUpdate (JsonVariantCallback _CB);
       bool doWsUpdate ();
@@ -2,8 +2,15 @@
  * @file JCA_IOT_Webserver_RestApi.cpp
  * @author JCA (https://github.com/ichok)
  * @brief RestAPI-Functions of the Server
- * @version 0.1
+ * @version 0.7
  * @date 2022-09-07
+ * @changelog
+ * - [0.2] 2026-10-17: MessagePack for Request-Body and Response
+ * - [0.3] 2026-10-17: GET without Body is answered from the shared Snapshot
+ * - [0.4] 2026-10-17: Paths for single Functions and Tags
+ * - [0.5] 2026-10-17: Documents are borrowed from the DocPool
+ * - [0.6] 2026-10-17: Responses are serialized Part by Part while they are sent
+ * - [0.7] 2026-10-17: The shared GET-Answer is a Document, it is serialized Part by Part too
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -14,10 +21,57 @@ using namespace JCA::SYS;
 
 namespace JCA {
   namespace IOT {
+    /**
+     * @brief Parse the received Body of a RestAPI-Request, MessagePack if the Content-Type says so, else JSON
+     *
+     * @param _Request Request with the Body inside _tempObject
+     */
+    void Server::onRestApiBody (AsyncWebServerRequest *_Request) {
+      Debug.println (FLAG_TRAFFIC, true, ObjectName, "RestAPI", "Request");
+      PooledDoc InDoc (DocPool::Requests);
+      JsonDocument &JBuffer = *InDoc;
+      JsonVariant InData;
+
+      if (_Request->_tempObject != nullptr) {
+        DeserializationError Error;
+        if (_Request->contentType ().startsWith (JCA_IOT_SERVER_MIME_MSGPACK)) {
+          Error = deserializeMsgPack (JBuffer, (const uint8_t *)(_Request->_tempObject), _Request->contentLength ());
+        } else {
+          Error = deserializeJson (JBuffer, (const char *)(_Request->_tempObject), _Request->contentLength ());
+        }
+        if (Error) {
+          if (Debug.print (FLAG_ERROR, true, ObjectName, "RestAPI", "+ deserialize failed: ")) {
+            Debug.println (FLAG_ERROR, true, ObjectName, "RestAPI", Error.c_str ());
+          }
+          JBuffer.clear ();
+        }
+      }
+      InData = JBuffer.as<JsonVariant> ();
+      onRestApiRequest (_Request, InData);
+    }
+
     void Server::onRestApiRequest (AsyncWebServerRequest *_Request, JsonVariant &_Json) {
-      JsonDocument JsonDoc;
-      JsonVariant OutData = JsonDoc.as<JsonVariant> ();
+      bool MsgPack = _Request->hasHeader ("Accept") && _Request->header ("Accept").indexOf (JCA_IOT_SERVER_MIME_MSGPACK) >= 0;
+
+      // The Handler of /api gets /api/... too
+      if (_Request->url ().length () > strlen (JCA_IOT_SERVER_PATH_API) + 1) {
+        onRestApiPath (_Request, _Request->url ().substring (strlen (JCA_IOT_SERVER_PATH_API) + 1), _Json, MsgPack);
+        return;
+      }
 
+      // A plain GET reads all Data, all Requests until the next Change share the same Answer
+      if (_Request->method () == HTTP_GET && _Json.isNull ()) {
+        std::shared_ptr<JsonDocument> Snapshot = getRestSnapshot ();
+        if (Snapshot) {
+          Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Snapshot");
+          restApiSend (_Request, 200, Snapshot, Snapshot->as<JsonVariantConst> (), MsgPack);
+          return;
+        }
+      }
+
+      PooledDoc OutDoc (DocPool::Requests);
+      JsonDocument &JsonDoc = *OutDoc;
+      JsonVariant OutData = JsonDoc.as<JsonVariant> ();
       if (Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, _Request->methodToString ())) {
         Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Body:");
         String JsonBody;
@@ -60,16 +114,124 @@ namespace JCA {
       default:
         break;
       }
+      // Requests with Body may have written Data
+      invalidateSnapshot ();
 
       // Add System Informations
       OutData["used"] = JsonDoc.size ();
 
-      // Create Response
-      String response;
-      serializeJson (OutData, response);
-      Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Response:");
-      Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, response);
-      _Request->send (200, "application/json", response);
+      restApiSend (_Request, 200, OutDoc, MsgPack);
+    }
+
+    /**
+     * @brief Get the Answer of the GET-Callback for a GET without Body. It is only shared while notifyChange
+     * reports the Changes, else every GET builds its own Answer. The Document is never changed after it is built,
+     * an outdated one lives until the last Response using it is sent.
+     *
+     * @return std::shared_ptr<JsonDocument> Answer, nullptr if it can not be shared
+     */
+    std::shared_ptr<JsonDocument> Server::getRestSnapshot () {
+      MutexLock Guard (SnapshotLock);
+      if (!ChangeNotified) {
+        return nullptr;
+      }
+      if (!RestSnapshot) {
+        Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "Build");
+        std::shared_ptr<JsonDocument> Data = std::make_shared<JsonDocument> ();
+        JsonVariant InData;
+        JsonVariant OutData = Data->to<JsonVariant> ();
+        if (restApiGetCB) {
+          restApiGetCB (InData, OutData);
+        }
+        // Add System Informations
+        OutData["used"] = Data->size ();
+        RestSnapshot = Data;
+      }
+      return RestSnapshot;
+    }
+
+    /**
+     * @brief Handle a Request on a Function (<function>) or a single Tag (<function>/<tag>)
+     *
+     * @param _Request Request
+     * @param _Path Path behind /api/
+     * @param _Json Body of the Request, the new Value for PUT
+     * @param _MsgPack Client accepts MessagePack
+     */
+    void Server::onRestApiPath (AsyncWebServerRequest *_Request, const String &_Path, JsonVariant &_Json, bool _MsgPack) {
+      PooledDoc OutDoc (DocPool::Requests);
+      JsonVariant OutData = OutDoc->as<JsonVariant> ();
+      int Code = 404;
+      int Split = _Path.indexOf ('/');
+      String Function = (Split < 0) ? _Path : _Path.substring (0, Split);
+      String Tag = (Split < 0) ? String () : _Path.substring (Split + 1);
+      Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Path: ");
+      Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, _Path);
+
+      switch (_Request->method ()) {
+      case HTTP_GET:
+        if (restApiPathGetCB) {
+          Code = restApiPathGetCB (Function, Tag, _Json, OutData);
+        }
+        break;
+
+      case HTTP_PUT:
+        // Only single Tags can be written
+        if (Tag.length () == 0) {
+          Code = 405;
+        } else if (restApiPathPutCB) {
+          Code = restApiPathPutCB (Function, Tag, _Json, OutData);
+          invalidateSnapshot ();
+        }
+        break;
+
+      default:
+        Code = 405;
+        break;
+      }
+      restApiSend (_Request, Code, OutDoc, _MsgPack);
+    }
+
+    /**
+     * @brief Send the Response, MessagePack only if the Client asks for it.
+     * The Response is not serialized into one Buffer, each Part is serialized when the Connection can take it.
+     * So the Document lives until the Response is sent.
+     *
+     * @param _Request Request to answer
+     * @param _Code HTTP-Status
+     * @param _Doc Data of the Response, moved into the Response
+     * @param _MsgPack Client accepts MessagePack
+     */
+    void Server::restApiSend (AsyncWebServerRequest *_Request, int _Code, PooledDoc &_Doc, bool _MsgPack) {
+      std::shared_ptr<PooledDoc> Doc = std::make_shared<PooledDoc> (std::move (_Doc));
+      restApiSend (_Request, _Code, Doc, (**Doc).as<JsonVariantConst> (), _MsgPack);
+    }
+
+    /**
+     * @brief Send Data that belongs to a shared Owner, e.g. the shared GET-Answer
+     *
+     * @param _Request Request to answer
+     * @param _Code HTTP-Status
+     * @param _Owner Owner of the Data, it is held until the Response is sent
+     * @param _Data Data of the Response
+     * @param _MsgPack Client accepts MessagePack
+     */
+    void Server::restApiSend (AsyncWebServerRequest *_Request, int _Code, std::shared_ptr<void> _Owner, JsonVariantConst _Data, bool _MsgPack) {
+      struct Response_T {
+        std::shared_ptr<void> Owner;
+        JsonParts Parts;
+        Response_T (std::shared_ptr<void> &_Owner, JsonVariantConst _Data, bool _MsgPack) : Owner (std::move (_Owner)), Parts (_Data, _MsgPack) {};
+      };
+      std::shared_ptr<Response_T> Data = std::make_shared<Response_T> (_Owner, _Data, _MsgPack);
+      size_t Length = Data->Parts.measure ();
+      Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Response: ");
+      Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, Length);
+      // The Parts are requested in Order, each Call continues where the last one stopped
+      AsyncWebServerResponse *Response = _Request->beginResponse (_MsgPack ? JCA_IOT_SERVER_MIME_MSGPACK : JCA_IOT_SERVER_MIME_JSON, Length, [Data] (uint8_t *_Out, size_t _MaxLen, size_t _Index) -> size_t {
+        return Data->Parts.read (_Out, _MaxLen);
+      });
+      Response->setCode (_Code);
+      _Request->send (Response);
     }
 
     void Server::onRestApiGet (JsonVariantCallback _CB) {
@@ -91,5 +253,13 @@ namespace JCA {
     void Server::onRestApiDelete (JsonVariantCallback _CB) {
       restApiDeleteCB = _CB;
     }
+
+    void Server::onRestApiPathGet (RestApiPathCallback _CB) {
+      restApiPathGetCB = _CB;
+    }
+
+    void Server::onRestApiPathPut (RestApiPathCallback _CB) {
+      restApiPathPutCB = _CB;
+    }
   }
 }
\ No newline at end of file
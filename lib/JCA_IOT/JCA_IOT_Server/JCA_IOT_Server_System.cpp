@@ -2,8 +2,10 @@
  * @file JCA_IOT_Webserver_System.cpp
  * @author JCA (https://github.com/ichok)
  * @brief System-Functions of the Server
- * @version 0.1
+ * @version 0.2
  * @date 2022-09-07
+ * @changelog
+ * - [0.2] 2026-10-17: Web-Content with Cache-Control, ETag and Last-Modified, JSON-Files without
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -54,7 +56,19 @@ namespace JCA {
       strncpy (ConfPassword, _ConfPassword, sizeof (ConfPassword));
       WsUpdateCycle = 1000;
       WsLastUpdate = millis ();
+      WsLastSubscriptions = WsLastUpdate;
+      WsPushInterval = 0;
+      WsPushPending = false;
+      WsPushMillis = WsLastUpdate;
+      WsPushDelay = JCA_IOT_SERVER_WS_COALESCE;
+      Snapshot.Valid = false;
+      Snapshot.Sequence = 0;
+      ChangeNotified = false;
       WebConfigFile = JCA_IOT_FILE_FUNCTIONS;
+      WebContent = nullptr;
+      WebContentStamp = 0;
+      WebContentHash = 0;
+      WebContentChanged = false;
       LocalTimeZone = _Offset;
       DaylightSavingTime = _DayLightSaving;
     }
@@ -212,6 +226,11 @@ namespace JCA {
             WsUpdateCycle = Config[JCA_IOT_SERVER_CONFKEY_SOCKETUPDATE].as<uint32_t> ();
             Debug.println (FLAG_CONFIG, true, ObjectName, __func__, WsUpdateCycle);
           }
+          if (Config[JCA_IOT_SERVER_CONFKEY_SOCKETPUSH].is<JsonVariant> ()) {
+            Debug.println (FLAG_CONFIG, true, ObjectName, __func__, "Config contains WebSocket Push: ");
+            WsPushInterval = Config[JCA_IOT_SERVER_CONFKEY_SOCKETPUSH].as<uint32_t> ();
+            Debug.println (FLAG_CONFIG, true, ObjectName, __func__, WsPushInterval);
+          }
           if (Config[JCA_IOT_SERVER_CONFKEY_LOCALTIMEZONE].is<JsonVariant> ()) {
             Debug.println (FLAG_CONFIG, true, ObjectName, __func__, "Config contains local Timezone: ");
             LocalTimeZone = Config[JCA_IOT_SERVER_CONFKEY_LOCALTIMEZONE].as<uint32_t> ();
@@ -240,6 +259,78 @@ namespace JCA {
       return RetValue;
     }
 
+    /**
+     * @brief Hash of the Names and Sizes of all Files in a Directory and below, except the JSON-Files.
+     * The Contents are not read, the gzip-Files of the Build-Script add the CRC-32 of their Trailer.
+     *
+     * @param _Path Directory
+     * @param _Hash Hash of the Files before
+     * @return uint32_t Hash including the Directory
+     */
+    static uint32_t hashDirectory (const String &_Path, uint32_t _Hash) {
+      File Dir = LittleFS.open (_Path, "r");
+      if (!Dir || !Dir.isDirectory ()) {
+        return _Hash;
+      }
+      String Base = _Path.endsWith ("/") ? _Path : _Path + "/";
+      for (File Entry = Dir.openNextFile (); Entry; Entry = Dir.openNextFile ()) {
+        String Name = Base + Entry.name ();
+        if (Entry.isDirectory ()) {
+          Entry.close ();
+          _Hash = hashDirectory (Name, _Hash);
+          continue;
+        }
+        if (Name.endsWith (".json")) {
+          continue;
+        }
+        // The Name with its Terminator separates the Files
+        uint32_t Size = Entry.size ();
+        _Hash = NameIndex::hash ((const uint8_t *)Name.c_str (), Name.length () + 1, _Hash);
+        _Hash = NameIndex::hash ((const uint8_t *)&Size, sizeof (Size), _Hash);
+        // gzip ends with the CRC-32 and the Size of the uncompressed Data
+        uint8_t Trailer[8];
+        if (Name.endsWith (".gz") && Size >= sizeof (Trailer) && Entry.seek (Size - sizeof (Trailer)) && Entry.read (Trailer, sizeof (Trailer)) == sizeof (Trailer)) {
+          _Hash = NameIndex::hash (Trailer, sizeof (Trailer), _Hash);
+        }
+      }
+      return _Hash;
+    }
+
+    /**
+     * @brief Rebuild the Hash of the Web-Content. The Files have no reliable Time, so the Last-Modified
+     * is derived from their Names and Sizes: it changes with every Upload or Filesystem-Image and repeats only for the same Files.
+     */
+    void Server::hashWebContent () {
+      uint32_t Hash = hashDirectory ("/", NameIndex::hash ("WebContent"));
+      Debug.print (FLAG_SETUP, true, ObjectName, __func__, "Hash: ");
+      Debug.println (FLAG_SETUP, true, ObjectName, __func__, String (Hash, HEX));
+      MutexLock Guard (WebContentLock);
+      WebContentHash = Hash;
+    }
+
+    /**
+     * @brief Filter of the Web-Content, the JSON-Files are written at Runtime and always sent completely.
+     * The Filter runs in the Context of the Server, so the Last-Modified of the Handler is only changed there.
+     *
+     * @param _Request Request
+     * @return true Request is served by the Web-Content
+     */
+    bool Server::filterWebContent (AsyncWebServerRequest *_Request) {
+      if (_Request->url ().endsWith (".json")) {
+        return false;
+      }
+      MutexLock Guard (WebContentLock);
+      if (WebContentStamp != WebContentHash) {
+        WebContentStamp = WebContentHash;
+        // 29 Bits of the Hash behind the first valid Time stay below 2038
+        time_t Stamp = JCA_IOT_SERVER_TIME_VALID + (WebContentHash & 0x1FFFFFFFUL);
+        tm Time;
+        gmtime_r (&Stamp, &Time);
+        WebContent->setLastModified (&Time);
+      }
+      return true;
+    }
+
     /**
      * @brief Get the last Sunday of the month
      *
@@ -317,24 +408,8 @@ namespace JCA {
 
       // RestAPI
       WebServerObject.on (
-          "/api", HTTP_ANY,
-          [this] (AsyncWebServerRequest *_Request) {
-            Debug.println (FLAG_TRAFFIC, true, this->ObjectName, "RestAPI", "Request");
-            JsonDocument JBuffer;
-            JsonVariant InData;
-
-            DeserializationError Error = deserializeJson (JBuffer, (char *)(_Request->_tempObject));
-            if (Error) {
-              if (Debug.print (FLAG_ERROR, true, ObjectName, "RestAPI", "+ deserializeJson() failed: ")) {
-                Debug.println (FLAG_ERROR, true, ObjectName, "RestAPI", Error.c_str ());
-                Debug.print (FLAG_ERROR, true, ObjectName, "RestAPI", "+ Body:");
-                Debug.println (FLAG_ERROR, true, ObjectName, "RestAPI", (char *)(_Request->_tempObject));
-              }
-              JBuffer.clear ();
-            }
-            InData = JBuffer.as<JsonVariant> ();
-            this->onRestApiRequest (_Request, InData);
-          },
+          JCA_IOT_SERVER_PATH_API, HTTP_ANY,
+          [this] (AsyncWebServerRequest *_Request) { this->onRestApiBody (_Request); },
           [this] (AsyncWebServerRequest *_Request, String _Filename, size_t _Index, uint8_t *_Data, size_t _Len, bool _Final) {
             Debug.println (FLAG_TRAFFIC, true, this->ObjectName, "RestAPI", "File");
           },
@@ -349,9 +424,14 @@ namespace JCA {
             }
           });
 
-      // Server - If not defined
-      WebServerObject.serveStatic ("/", LittleFS, "/")
-          .setDefaultFile (JCA_IOT_SERVER_PATH_HOME);
+      // Server - If not defined, the Web-Content is revalidated by the Browser (304 if unchanged)
+      // The JSON-Files are written at Runtime and always sent completely
+      WebContent = &WebServerObject.serveStatic ("/", LittleFS, "/");
+      WebContent->setDefaultFile (JCA_IOT_SERVER_PATH_HOME)
+          .setCacheControl (JCA_IOT_SERVER_CACHE_CONTROL);
+      WebContent->setFilter ([this] (AsyncWebServerRequest *_Request) { return filterWebContent (_Request); });
+      hashWebContent ();
+      WebServerObject.serveStatic ("/", LittleFS, "/");
       WebServerObject.onNotFound ([] (AsyncWebServerRequest *_Request) { _Request->redirect (JCA_IOT_SERVER_PATH_SYS); });
       WebServerObject.begin ();
 
@@ -373,6 +453,21 @@ namespace JCA {
         doWsUpdate (nullptr);
         WsLastUpdate = ActMillis;
       }
+      // Uploaded Files change the Last-Modified, the Files are read here and not in the Upload-Handler
+      if (WebContentChanged.exchange (false)) {
+        hashWebContent ();
+      }
+      // Push of notified Changes, after the Coalescing-Window
+      if (wsPushDue (ActMillis)) {
+        if (WsPushInterval > 0) {
+          doWsPush ();
+        }
+      }
+      // Subscriptions have their own Intervals, checked in a fixed Raster
+      if (ActMillis - WsLastSubscriptions >= JCA_IOT_SERVER_WS_MIN_INTERVAL) {
+        doWsSubscriptions ();
+        WsLastSubscriptions = ActMillis;
+      }
       // Check WiFi Connection
       Connector.handle ();
       return Connector.isConnected ();
@@ -411,6 +506,7 @@ namespace JCA {
       Config[JCA_IOT_SERVER_CONFKEY_UDPPORT] = UdpListenerPort;
       Config[JCA_IOT_SERVER_CONFKEY_LOCALTIMEZONE] = LocalTimeZone;
       Config[JCA_IOT_SERVER_CONFKEY_SOCKETUPDATE] = WsUpdateCycle;
+      Config[JCA_IOT_SERVER_CONFKEY_SOCKETPUSH] = WsPushInterval;
       Config[JCA_IOT_SERVER_CONFKEY_DAYLIGHTSAVING] = DaylightSavingTime;
       Config[JCA_IOT_SERVER_CONFKEY_REBOOTCOUNTER] = RebootCounter;
 
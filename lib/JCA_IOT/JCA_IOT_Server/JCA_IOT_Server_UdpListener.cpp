@@ -2,8 +2,10 @@
  * @file JCA_IOT_UdpListener.cpp
  * @author JCA (https://github.com/ichok)
  * @brief UdpListener-Functions of the Server
- * @version 0.1
+ * @version 0.2
  * @date 2025-04-06
+ * @changelog
+ * - [0.2] 2026-10-17: Document from the DocPool, the Packet is parsed with its Length
  *
  * Copyright Jochen Cabrera 2025
  * Apache License
@@ -16,10 +18,12 @@ namespace JCA {
   namespace IOT {
     void Server::udpPacketHandler (AsyncUDPPacket _Packet) {
       Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "Packet received");
-      JsonDocument JBuffer;
+      PooledDoc InDoc (DocPool::Requests);
+      JsonDocument &JBuffer = *InDoc;
       JsonObject InData;
 
-      DeserializationError Error = deserializeJson (JBuffer, _Packet.data ());
+      // The Packet has no Terminator
+      DeserializationError Error = deserializeJson (JBuffer, (const char *)_Packet.data (), _Packet.length ());
       if (Error) {
         if (Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ deserializeJson() failed: ")) {
           Debug.println (FLAG_ERROR, true, ObjectName, __func__, Error.c_str ());
@@ -2,8 +2,10 @@
  * @file JCA_IOT_Webserver_Web.cpp
  * @author JCA (https://github.com/ichok)
  * @brief Website-Functions of the Server
- * @version 0.1
+ * @version 0.2
  * @date 2022-09-07
+ * @changelog
+ * - [0.2] 2026-10-17: Framework-Sites from pre-compressed PROGMEM-Segments, stale Files of an Upload are removed
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -111,7 +113,13 @@ namespace JCA {
       if (!_Request->authenticate (ConfUser, ConfPassword)) {
         return _Request->requestAuthentication ();
       }
-      _Request->send (200, "text/html", PageFrame, [this] (const String &_Var) -> String { return this->replaceConnectWildcards (_Var); });
+      AwsTemplateProcessor Replace = [this] (const String &_Var) -> String { return this->replaceConnectWildcards (_Var); };
+#ifdef JCA_IOT_SERVER_WEBGZ
+      if (acceptsGzip (_Request)) {
+        return sendGzPage (_Request, WebGzConnect, Replace);
+      }
+#endif
+      _Request->send (200, "text/html", PageFrame, Replace);
     }
 
     /**
@@ -123,7 +131,115 @@ namespace JCA {
       if (!_Request->authenticate (ConfUser, ConfPassword)) {
         return _Request->requestAuthentication ();
       }
-      _Request->send (200, "text/html", PageFrame, [this] (const String &_Var) -> String { return this->replaceSystemWildcards (_Var); });
+      AwsTemplateProcessor Replace = [this] (const String &_Var) -> String { return this->replaceSystemWildcards (_Var); };
+#ifdef JCA_IOT_SERVER_WEBGZ
+      if (acceptsGzip (_Request)) {
+        return sendGzPage (_Request, WebGzSys, Replace);
+      }
+#endif
+      _Request->send (200, "text/html", PageFrame, Replace);
+    }
+
+    /**
+     * @brief Check if the Client accepts a gzip-encoded Response
+     *
+     * @param _Request Request data from Web-Client
+     * @return true gzip is in Accept-Encoding
+     */
+    bool Server::acceptsGzip (AsyncWebServerRequest *_Request) {
+      return _Request->hasHeader ("Accept-Encoding") && _Request->header ("Accept-Encoding").indexOf ("gzip") >= 0;
+    }
+
+    /**
+     * @brief Send a pre-compressed Page as gzip. The Segments are copied from PROGMEM, the Values of the
+     * Placeholders are put in between as stored Deflate-Blocks. Only the Values are processed on a Request,
+     * the CRC of the Page is combined from the CRCs of the Segments.
+     *
+     * @param _Request Request data from Web-Client
+     * @param _Page Segments of the Page, created by compress_web.py
+     * @param _Replace Replace-Function for the Placeholders
+     */
+    void Server::sendGzPage (AsyncWebServerRequest *_Request, const WebGzPage_T &_Page, AwsTemplateProcessor _Replace) {
+      struct Part_T {
+        const uint8_t *Flash; ///< Part in PROGMEM, nullptr for a Part of Ram
+        size_t Offset;        ///< Offset in Ram
+        size_t Length;
+      };
+      struct Body_T {
+        std::vector<Part_T> Parts;
+        std::vector<uint8_t> Ram; ///< gzip-Header, Values with their Block-Headers and gzip-Trailer
+        size_t Length = 0;
+        void addRam (const uint8_t *_Data, size_t _Length) {
+          if (!Parts.empty () && Parts.back ().Flash == nullptr) {
+            Parts.back ().Length += _Length;
+          } else {
+            Parts.push_back ({nullptr, Ram.size (), _Length});
+          }
+          Ram.insert (Ram.end (), _Data, _Data + _Length);
+          Length += _Length;
+        }
+      };
+      static const uint8_t Header[] = {0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff};
+      static const uint8_t FinalBlock[] = {0x03, 0x00}; // empty fixed Huffman Block with the Final-Bit
+
+      std::shared_ptr<Body_T> Body = std::make_shared<Body_T> ();
+      Body->Parts.reserve (_Page.Count * 2 + 1);
+      Body->addRam (Header, sizeof (Header));
+      uint32_t Crc = 0;
+      uint32_t Size = 0;
+      for (uint8_t i = 0; i < _Page.Count; i++) {
+        const WebGzSegment_T &Segment = _Page.Segments[i];
+        if (Segment.Length > 0) {
+          Body->Parts.push_back ({Segment.Data, 0, Segment.Length});
+          Body->Length += Segment.Length;
+        }
+        Crc = Crc32Combine (Crc, Segment.Crc, Segment.Size);
+        Size += Segment.Size;
+        if (Segment.Placeholder == nullptr) {
+          continue;
+        }
+        String Value = _Replace (Segment.Placeholder);
+        const uint8_t *Data = reinterpret_cast<const uint8_t *> (Value.c_str ());
+        size_t Remaining = Value.length ();
+        while (Remaining > 0) {
+          uint16_t Length = (Remaining > 0xFFFF) ? 0xFFFF : Remaining;
+          uint8_t Stored[] = {0x00, (uint8_t)(Length & 0xFF), (uint8_t)(Length >> 8), (uint8_t)(~Length & 0xFF), (uint8_t)((uint16_t)~Length >> 8)};
+          Body->addRam (Stored, sizeof (Stored));
+          Body->addRam (Data, Length);
+          Data += Length;
+          Remaining -= Length;
+        }
+        Crc = Crc32 (reinterpret_cast<const uint8_t *> (Value.c_str ()), Value.length (), Crc);
+        Size += Value.length ();
+      }
+      uint8_t Trailer[] = {(uint8_t)Crc, (uint8_t)(Crc >> 8), (uint8_t)(Crc >> 16), (uint8_t)(Crc >> 24), (uint8_t)Size, (uint8_t)(Size >> 8), (uint8_t)(Size >> 16), (uint8_t)(Size >> 24)};
+      Body->addRam (FinalBlock, sizeof (FinalBlock));
+      Body->addRam (Trailer, sizeof (Trailer));
+
+      AsyncWebServerResponse *Response = _Request->beginResponse ("text/html", Body->Length, [Body] (uint8_t *_Out, size_t _MaxLen, size_t _Index) -> size_t {
+        size_t Written = 0;
+        size_t Start = 0;
+        for (const Part_T &Part : Body->Parts) {
+          if (Written >= _MaxLen) {
+            break;
+          }
+          if (_Index + Written < Start + Part.Length) {
+            size_t Offset = _Index + Written - Start;
+            size_t Length = std::min (Part.Length - Offset, _MaxLen - Written);
+            if (Part.Flash != nullptr) {
+              memcpy_P (_Out + Written, Part.Flash + Offset, Length);
+            } else {
+              memcpy (_Out + Written, Body->Ram.data () + Part.Offset + Offset, Length);
+            }
+            Written += Length;
+          }
+          Start += Part.Length;
+        }
+        return Written;
+      });
+      Response->addHeader ("Content-Encoding", "gzip");
+      Response->addHeader ("Vary", "Accept-Encoding");
+      _Request->send (Response);
     }
 
     /**
@@ -143,6 +259,11 @@ namespace JCA {
       Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, String ("Client:" + _Request->client ()->remoteIP ().toString () + " " + _Request->url ()));
       if (!_Index) {
         Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, String ("Upload Start: " + String (_Filename)));
+        // serveStatic prefers the .gz, the other Variant must neither hide nor outlive the uploaded File
+        String Stale = _Filename.endsWith (".gz") ? "/" + _Filename.substring (0, _Filename.length () - 3) : "/" + _Filename + ".gz";
+        if (LittleFS.exists (Stale)) {
+          LittleFS.remove (Stale);
+        }
         // open the file on first call and store the file handle in the request object
         _Request->_tempFile = LittleFS.open ("/" + _Filename, "w");
       }
@@ -155,6 +276,7 @@ namespace JCA {
         Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, String ("Upload Complete: " + String (_Filename) + ",size: " + String (_Index + _Len)));
         // close the file handle as the upload is now done
         _Request->_tempFile.close ();
+        WebContentChanged = true;
       }
     }
 
@@ -348,10 +470,10 @@ namespace JCA {
         return RetVal;
       }
       if (var == "NAME") {
-        return F ("System");
+        return String (NameSys);
       }
       if (var == "STYLE") {
-        return F (":root{--ColorSystem:var(--contrast)}");
+        return String (StyleSys);
       }
       if (var == "SECTION") {
         return String (SectionSys);
@@ -385,6 +507,12 @@ namespace JCA {
      */
     String Server::replaceConnectWildcards (const String &var) {
       String RetVal;
+      if (var == "NAME") {
+        return String (NameConnect);
+      }
+      if (var == "STYLE") {
+        return String (StyleConnect);
+      }
       RetVal = Connector.replaceWildcards (var);
       if (!RetVal.isEmpty ()) {
         Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "Replace from Connector Function");
@@ -2,8 +2,10 @@
  * @file JCA_IOT_Webserver_Sites.h
  * @author JCA (https://github.com/ichok)
  * @brief Default Web Content for WebSite Frame
- * @version 0.1
+ * @version 0.2
  * @date 2022-09-04
+ * @changelog
+ * - [0.2] 2026-10-17: Names and Styles of the Framework-Sites, pre-compressed Pages from compress_web.py
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -14,6 +16,7 @@
 #define _JCA_IOT_SERVER_SITES_
 
 #include <Arduino.h>
+#include <stdint.h>
 
 /**
  * @brief Static Web Frame for Famework Sites
@@ -88,7 +91,7 @@ Board MCU: %BOARD_MCU%<br/>
 <article>
 <header>Upload Web-Content</header>
 <form method="POST" action="/upload" enctype="multipart/form-data">
-<label for="jsonUpload">Choose a config file or web content:<input type="file" id="jsonUpload" name="jsonUpload" accept=".json, .htm, .html, .js, .css"></label>
+<label for="jsonUpload">Choose a config file or web content:<input type="file" id="jsonUpload" name="jsonUpload" accept=".json, .htm, .html, .js, .css, .svg, .gz"></label>
 <button type="submit">Upload</button>
 </form>
 </article>
@@ -107,4 +110,37 @@ Board MCU: %BOARD_MCU%<br/>
 </article>
 )rawliteral";
 
+/**
+ * @brief Names and Styles of the Framework Sites
+ */
+const char NameSys[] PROGMEM = R"rawliteral(System)rawliteral";
+const char StyleSys[] PROGMEM = R"rawliteral(:root{--ColorSystem:var(--contrast)})rawliteral";
+const char NameConnect[] PROGMEM = R"rawliteral(WiFi Connect)rawliteral";
+const char StyleConnect[] PROGMEM = R"rawliteral(:root{--ColorWiFi:var(--contrast)})rawliteral";
+
+/**
+ * @brief Text of a pre-compressed Page up to the next Placeholder, see compress_web.py
+ */
+struct WebGzSegment_T {
+  const uint8_t *Data;     ///< Deflate-Blocks in PROGMEM, byte-aligned and not final
+  uint32_t Length;         ///< Length of the Deflate-Blocks
+  uint32_t Size;           ///< Length of the Text
+  uint32_t Crc;            ///< CRC32 of the Text
+  const char *Placeholder; ///< Placeholder after the Text, nullptr for the last Segment
+};
+
+/**
+ * @brief Framework Site with the Frame and its Section as Deflate-Segments
+ */
+struct WebGzPage_T {
+  const WebGzSegment_T *Segments;
+  uint8_t Count;
+};
+
+// Created by compress_web.py during the Build, without it the Pages are processed as Templates
+#if __has_include(<JCA_IOT_Server_WebGz.h>)
+  #include <JCA_IOT_Server_WebGz.h>
+  #define JCA_IOT_SERVER_WEBGZ
+#endif
+
 #endif
\ No newline at end of file
@@ -2,8 +2,16 @@
  * @file JCA_IOT_Webserver_Socket.cpp
  * @author JCA (https://github.com/ichok)
  * @brief WebSocket-Functions of the Server
- * @version 0.1
+ * @version 0.8
  * @date 2022-09-23
+ * @changelog
+ * - [0.2] 2026-10-17: Only the Changes since the last Update are sent to each Client
+ * - [0.3] 2026-10-17: MessagePack for Clients that send binary Messages or switch the Format
+ * - [0.4] 2026-10-17: Messages are serialized once into shared Buffers, new Clients get the Snapshot
+ * - [0.5] 2026-10-17: Subscriptions of Function/Tag-Patterns with an own Interval
+ * - [0.6] 2026-10-17: Event-driven Push with Coalescing-Window and a Rate-Limit per Client
+ * - [0.7] 2026-10-17: Receive without Heap-Churn, single Frames are parsed in place, fragmented Messages use a Buffer per Client
+ * - [0.8] 2026-10-17: Documents are borrowed from the DocPool
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -27,80 +35,287 @@ namespace JCA {
     void Server::onWsEvent (AsyncWebSocket *_Server, AsyncWebSocketClient *_Client, AwsEventType _Type, void *_Arg, uint8_t *_Data, size_t _Len) {
       Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "Start");
       if (_Type == WS_EVT_CONNECT) {
+        {
+          MutexLock Guard (WsClientLock);
+          WsClient_T &Client = WsClients[_Client->id ()];
+          Client.Sequence = 0;
+          Client.MsgPack = false;
+          Client.LastMillis = millis ();
+          Client.RxDrop = false;
+          Client.RxBuffer.reserve (JCA_IOT_SERVER_WS_RX_SIZE);
+        }
         doWsUpdate (_Client);
+      } else if (_Type == WS_EVT_DISCONNECT) {
+        MutexLock Guard (WsClientLock);
+        WsClients.erase (_Client->id ());
       } else if (_Type == WS_EVT_DATA) {
         wsHandleData (_Client, _Arg, _Data, _Len);
       }
     }
 
+    /**
+     * @brief Serialize Data into a reference counted Buffer, that can be queued by several Clients and Responses
+     *
+     * @param _Data Data to serialize
+     * @param _MsgPack MessagePack instead of JSON
+     * @return AsyncWebSocketSharedBuffer Buffer without Null-Terminator
+     */
+    AsyncWebSocketSharedBuffer Server::serializeShared (JsonVariantConst _Data, bool _MsgPack) {
+      AsyncWebSocketSharedBuffer Buffer = std::make_shared<std::vector<uint8_t>> ();
+      if (_MsgPack) {
+        Buffer->resize (measureMsgPack (_Data));
+        serializeMsgPack (_Data, Buffer->data (), Buffer->size ());
+      } else {
+        // One Byte more for the Terminator, that is removed again
+        Buffer->resize (measureJson (_Data) + 1);
+        Buffer->resize (serializeJson (_Data, reinterpret_cast<char *> (Buffer->data ()), Buffer->size ()));
+      }
+      return Buffer;
+    }
+
+    /**
+     * @brief Send a Message in the Format of the Client, each Format is only serialized once
+     * and all Clients queue the same Buffer
+     *
+     * @param _Client Receiver
+     * @param _MsgPack Client uses MessagePack
+     * @param _Data Message
+     * @param _Message Buffers of the Message, created on the first Send of each Format
+     */
+    void Server::wsSend (AsyncWebSocketClient *_Client, bool _MsgPack, JsonVariantConst _Data, WsMessage_T &_Message) {
+      AsyncWebSocketSharedBuffer &Buffer = _MsgPack ? _Message.Pack : _Message.Json;
+      if (!Buffer) {
+        Buffer = serializeShared (_Data, _MsgPack);
+        Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Serialized: ");
+        Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, Buffer->size ());
+      }
+      if (_MsgPack) {
+        _Client->binary (Buffer);
+      } else {
+        _Client->text (Buffer);
+      }
+    }
+
+    /**
+     * @brief Get the serialized Snapshot of all Data, it is only build if there is no valid one.
+     * May be called from the Server-Task, the Update-Callback is only called with since = 0.
+     *
+     * @param _MsgPack MessagePack instead of JSON
+     * @param _Sequence Sequence of the Snapshot, 0 if the Callback has no Sequences
+     * @return AsyncWebSocketSharedBuffer serialized Snapshot
+     */
+    AsyncWebSocketSharedBuffer Server::getSnapshot (bool _MsgPack, uint32_t &_Sequence) {
+      MutexLock Guard (SnapshotLock);
+      if (!Snapshot.Valid) {
+        Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, "Build");
+        buildWsUpdate (0, Snapshot.Data, Snapshot.Sequence);
+        Snapshot.Message = WsMessage_T ();
+        Snapshot.Valid = true;
+      }
+      _Sequence = Snapshot.Sequence;
+      AsyncWebSocketSharedBuffer &Buffer = _MsgPack ? Snapshot.Message.Pack : Snapshot.Message.Json;
+      if (!Buffer) {
+        Buffer = serializeShared (Snapshot.Data.as<JsonVariantConst> (), _MsgPack);
+      }
+      return Buffer;
+    }
+
+    /**
+     * @brief Drop the Snapshots, Buffers still queued by Clients stay alive until they are sent
+     */
+    void Server::invalidateSnapshot () {
+      MutexLock Guard (SnapshotLock);
+      Snapshot.Valid = false;
+      Snapshot.Data.clear ();
+      Snapshot.Message = WsMessage_T ();
+      RestSnapshot.reset ();
+    }
+
+    /**
+     * @brief Collect the Frames of a Message. A Message in one Frame is parsed directly from the Frame,
+     * fragmented Messages are collected in the Receive-Buffer of the Client.
+     * Messages longer than JCA_IOT_SERVER_WS_RX_MAX are dropped without buffering.
+     *
+     * @param _Client Sender
+     * @param _Arg Frame-Info
+     * @param _Data Part of the Frame
+     * @param _Len Length of the Part
+     */
     void Server::wsHandleData (AsyncWebSocketClient *_Client, void *_Arg, uint8_t *_Data, size_t _Len) {
       AwsFrameInfo *Info = (AwsFrameInfo *)_Arg;
-      if (Info->opcode == WS_TEXT) {
-        // Initialise Message-Buffer on first Frame
-        if (Info->index == 0) {
-          _Client->_tempObject = malloc (Info->len + 10);
-          Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ MsgLen: ");
-          Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, Info->len);
-        }
-        // Append Data to Message-Buffer
-        memcpy ((uint8_t *)(_Client->_tempObject) + Info->index, _Data, _Len);
-        // Handle Message if last Frame ist received
-        if (Info->final && Info->index + _Len == Info->len) {
-          ((uint8_t *)(_Client->_tempObject))[Info->len] = 0;
-          JsonDocument JsonInDoc;
-          JsonDocument JsonOutDoc;
-          JsonVariant InData;
-          JsonVariant OutData = JsonOutDoc.as<JsonVariant> ();
-
-          Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ Buffer: ");
-          Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, (char *)(_Client->_tempObject));
-
-          DeserializationError Error = deserializeJson (JsonInDoc, (char *)(_Client->_tempObject));
-          if (Error) {
-            if (Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ deserializeJson() failed: ")) {
-              Debug.println (FLAG_ERROR, true, ObjectName, __func__, Error.c_str ());
-              Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ Body:");
-              Debug.println (FLAG_ERROR, true, ObjectName, __func__, (char *)(_Client->_tempObject));
-            }
-            JsonInDoc.clear ();
-          }
-
-          InData = JsonInDoc.as<JsonVariant> ();
+      if (Info->message_opcode != WS_TEXT && Info->message_opcode != WS_BINARY) {
+        return;
+      }
+      // Binary Messages are MessagePack, the Client gets the same Format back
+      bool MsgPack = (Info->message_opcode == WS_BINARY);
+      bool First = (Info->num == 0 && Info->index == 0);
+      bool Last = (Info->final && Info->index + _Len == Info->len);
+      PooledDoc InDoc (DocPool::Requests);
+      JsonDocument &JsonInDoc = *InDoc;
+      DeserializationError Error;
 
-          // Call externak datahandling Functions
-          if (wsDataCB) {
-            wsDataCB (InData, OutData);
-          } else if (restApiPostCB) {
-            restApiPostCB (InData, OutData);
+      if (First && Last) {
+        // Complete Message in one Frame
+        if (Info->len > JCA_IOT_SERVER_WS_RX_MAX) {
+          if (Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ Message too long: ")) {
+            Debug.println (FLAG_ERROR, true, ObjectName, __func__, (uint32_t)Info->len);
           }
-
-          // Create Response
-          String Response;
-          serializeJson (OutData, Response);
-          Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, Response);
-          if (_Client->canSend ()) {
-            _Client->text (Response);
+          return;
+        }
+        Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ MsgLen: ");
+        Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, _Len);
+        Error = wsParse (JsonInDoc, _Data, _Len, MsgPack);
+      } else {
+        MutexLock Guard (WsClientLock);
+        std::map<uint32_t, WsClient_T>::iterator Client = WsClients.find (_Client->id ());
+        if (Client == WsClients.end ()) {
+          return;
+        }
+        std::vector<uint8_t> &Buffer = Client->second.RxBuffer;
+        if (First) {
+          Buffer.clear ();
+          Client->second.RxDrop = false;
+        }
+        if (Client->second.RxDrop) {
+          return;
+        }
+        // The Length of the Frame is known with its first Part
+        if (Info->index == 0 && Buffer.size () + Info->len > JCA_IOT_SERVER_WS_RX_MAX) {
+          if (Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ Message too long: ")) {
+            Debug.println (FLAG_ERROR, true, ObjectName, __func__, (uint32_t)(Buffer.size () + Info->len));
           }
+          Buffer.clear ();
+          Client->second.RxDrop = true;
+          return;
+        }
+        if (Buffer.size () + _Len > Buffer.capacity ()) {
+          Buffer.reserve (std::min<size_t> (std::max<size_t> (Buffer.capacity () * 2, Buffer.size () + Info->len - Info->index), JCA_IOT_SERVER_WS_RX_MAX));
+        }
+        Buffer.insert (Buffer.end (), _Data, _Data + _Len);
+        if (!Last) {
+          return;
+        }
+        Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "+ MsgLen: ");
+        Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, Buffer.size ());
+        Error = wsParse (JsonInDoc, Buffer.data (), Buffer.size (), MsgPack);
+        Buffer.clear ();
+      }
+      if (Error) {
+        if (Debug.print (FLAG_ERROR, true, ObjectName, __func__, "+ deserialize failed: ")) {
+          Debug.println (FLAG_ERROR, true, ObjectName, __func__, Error.c_str ());
         }
+        JsonInDoc.clear ();
       }
+      wsHandleMessage (_Client, JsonInDoc, MsgPack);
     }
 
-    bool Server::doWsUpdate (AsyncWebSocketClient *_Client) {
-      JsonDocument JsonDoc;
-      JsonVariant InData;
-      JsonVariant OutData = JsonDoc.as<JsonVariant> ();
+    /**
+     * @brief Parse a received Message, the Data needs no Null-Terminator
+     *
+     * @param _Doc Target
+     * @param _Data Message
+     * @param _Len Length of the Message
+     * @param _MsgPack MessagePack instead of JSON
+     * @return DeserializationError Result of ArduinoJson
+     */
+    DeserializationError Server::wsParse (JsonDocument &_Doc, const uint8_t *_Data, size_t _Len, bool _MsgPack) {
+      if (_MsgPack) {
+        return deserializeMsgPack (_Doc, _Data, _Len);
+      }
+      return deserializeJson (_Doc, reinterpret_cast<const char *> (_Data), _Len);
+    }
 
-      if (_Client != nullptr) {
-        // check if selected Client can send Data
-        if (!_Client->canSend ()) {
-          return false;
-        }
-      } else {
-        // check if selected Client can send Data
-        if (WebSocketObject.count () == 0) {
-          return false;
+    /**
+     * @brief Handle a complete Message, Control-Keys are applied to the Client and the Rest is passed to the Callback
+     *
+     * @param _Client Sender
+     * @param _InDoc Message, empty if it could not be parsed
+     * @param _MsgPack Message was binary
+     */
+    void Server::wsHandleMessage (AsyncWebSocketClient *_Client, JsonDocument &_InDoc, bool _MsgPack) {
+      PooledDoc OutDoc (DocPool::Requests);
+      JsonVariant OutData = OutDoc->as<JsonVariant> ();
+      JsonVariant InData = _InDoc.as<JsonVariant> ();
+      bool MsgPack = _MsgPack;
+
+      // Switch the Format of the Client by a binary Message or explicit, all Data is sent again in the new Format
+      bool Switch = MsgPack;
+      bool Control = false;
+      if (InData[JCA_IOT_SERVER_WS_FORMAT].is<const char *> ()) {
+        MsgPack = (strcmp (InData[JCA_IOT_SERVER_WS_FORMAT].as<const char *> (), JCA_IOT_SERVER_WS_FORMAT_MSGPACK) == 0);
+        InData.remove (JCA_IOT_SERVER_WS_FORMAT);
+        Switch = true;
+        Control = true;
+      }
+      JsonArray Subscriptions;
+      if (InData[JCA_IOT_SERVER_WS_SUBSCRIBE].is<JsonArray> ()) {
+        Subscriptions = InData[JCA_IOT_SERVER_WS_SUBSCRIBE].as<JsonArray> ();
+        Control = true;
+      }
+      {
+        MutexLock Guard (WsClientLock);
+        std::map<uint32_t, WsClient_T>::iterator Client = WsClients.find (_Client->id ());
+        if (Client != WsClients.end ()) {
+          if (Switch && Client->second.MsgPack != MsgPack) {
+            Client->second.MsgPack = MsgPack;
+            Client->second.Sequence = 0;
+            for (WsSubscription_T &Subscription : Client->second.Subscriptions) {
+              Subscription.Sequence = 0;
+            }
+          }
+          MsgPack = Client->second.MsgPack;
+          if (!Subscriptions.isNull ()) {
+            wsSubscribe (Client->second, Subscriptions);
+          }
         }
       }
+      if (!Subscriptions.isNull ()) {
+        InData.remove (JCA_IOT_SERVER_WS_SUBSCRIBE);
+      }
+      // Pure Control-Messages are not passed to the Callbacks, the Client gets its Data by the next Update
+      if (Control && InData.size () == 0) {
+        return;
+      }
+
+      // Call externak datahandling Functions
+      if (wsDataCB) {
+        wsDataCB (InData, OutData);
+      } else if (restApiPostCB) {
+        restApiPostCB (InData, OutData);
+      }
+      // Written Values are applied by a later Cycle, its Changes invalidate the Snapshots (wsCheckSnapshot, notifyChange)
+
+      // Create Response
+      if (_Client->canSend ()) {
+        WsMessage_T Message;
+        wsSend (_Client, MsgPack, OutData, Message);
+      }
+    }
+
+    /**
+     * @brief Get the Update-Data from the Callback
+     *
+     * @param _Since Sequence of the last Update of the Client, 0 for all Data
+     * @param _Data Document for the Update
+     * @param _Sequence Sequence of the Update, 0 if the Callback does not support Sequences
+     * @param _Function Pattern of the Function-Names, nullptr for all
+     * @param _Tag Pattern of the Tag-Names, nullptr for all
+     * @return true Update created
+     * @return false nothing changed since _Since
+     */
+    bool Server::buildWsUpdate (uint32_t _Since, JsonDocument &_Data, uint32_t &_Sequence, const char *_Function, const char *_Tag) {
+      PooledDoc InDoc (DocPool::Requests);
+      JsonDocument &JsonInDoc = *InDoc;
+      JsonInDoc[JCA_IOT_SERVER_WS_SINCE] = _Since;
+      if (_Function != nullptr) {
+        JsonInDoc[JCA_IOT_SERVER_WS_FUNCTION] = _Function;
+      }
+      if (_Tag != nullptr) {
+        JsonInDoc[JCA_IOT_SERVER_WS_TAG] = _Tag;
+      }
+      JsonVariant InData = JsonInDoc.as<JsonVariant> ();
+      _Data.clear ();
+      JsonVariant OutData = _Data.as<JsonVariant> ();
 
       // Call externak datahandling Functions
       if (wsUpdateCB) {
@@ -109,16 +324,282 @@ namespace JCA {
         restApiGetCB (InData, OutData);
       }
 
-      // Create Response
-      String Response;
-      serializeJson (OutData, Response);
-      Debug.println (FLAG_LOOP, true, ObjectName, __func__, Response);
+      _Sequence = OutData[JCA_IOT_SERVER_WS_SEQUENCE] | (uint32_t)0;
+      if (_Sequence != 0 && _Sequence == _Since) {
+        return false;
+      }
+      OutData.remove (JCA_IOT_SERVER_WS_SEQUENCE);
+      return true;
+    }
+
+    /**
+     * @brief Send the Data to a new Client, or the Changes to all Clients
+     *
+     * @param _Client new Client that gets all Data, nullptr to update all Clients
+     * @return true at least one Message was sent
+     * @return false nothing to send or no Client ready
+     */
+    bool Server::doWsUpdate (AsyncWebSocketClient *_Client) {
       if (_Client != nullptr) {
-        _Client->text (Response);
-      } else {
-        WebSocketObject.textAll (Response);
+        // check if selected Client can send Data, new Clients start with JSON
+        if (!_Client->canSend ()) {
+          return false;
+        }
+        uint32_t Sequence = 0;
+        _Client->text (getSnapshot (false, Sequence));
+        MutexLock Guard (WsClientLock);
+        WsClient_T &Client = WsClients[_Client->id ()];
+        Client.Sequence = Sequence;
+        Client.LastMillis = millis ();
+        return true;
+      }
+      WsBuild_T Build;
+      wsCheckSnapshot (Build);
+      return wsSendChanges (Build, false);
+    }
+
+    /**
+     * @brief Push the Changes after a Change was notified and the Coalescing-Window is over.
+     * Clients that got a Message within WsPushInterval are deferred to the next Push.
+     *
+     * @return true at least one Message was sent
+     */
+    bool Server::doWsPush () {
+      WsBuild_T Build;
+      wsCheckSnapshot (Build);
+      return wsSendChanges (Build, true);
+    }
+
+    /**
+     * @brief Check the Snapshot, without Sequences it can only live for one Cycle.
+     * The Changes since the Snapshot are kept for the Clients at the same Sequence.
+     *
+     * @param _Build Changes since the Snapshot, if it was checked
+     */
+    void Server::wsCheckSnapshot (WsBuild_T &_Build) {
+      {
+        MutexLock Guard (SnapshotLock);
+        if (Snapshot.Valid && Snapshot.Sequence != 0) {
+          _Build.Since = Snapshot.Sequence;
+          _Build.Changed = buildWsUpdate (_Build.Since, *_Build.Data, _Build.Sequence);
+          _Build.Built = true;
+        }
       }
+      if (!_Build.Built || _Build.Changed) {
+        invalidateSnapshot ();
+      }
+    }
+
+    /**
+     * @brief Send the Changes to all Clients without Subscriptions.
+     * Clients with the same Sequence share the Message, normally all of them.
+     * A busy Client keeps its Sequence and gets all missed Changes with the next Update.
+     *
+     * @param _Build Changes already built, reused if the Sequence matches
+     * @param _Push limit each Client to one Message per WsPushInterval
+     * @return true at least one Message was sent
+     */
+    bool Server::wsSendChanges (WsBuild_T &_Build, bool _Push) {
+      // check if selected Client can send Data
+      if (WebSocketObject.count () == 0) {
+        return false;
+      }
+      unsigned long ActMillis = millis ();
+      bool Sent = false;
+      bool Deferred = false;
+      unsigned long Wait = WsPushInterval;
+      MutexLock Guard (WsClientLock);
+      for (std::pair<const uint32_t, WsClient_T> &Client : WsClients) {
+        AsyncWebSocketClient *WsClient = WebSocketObject.client (Client.first);
+        if (WsClient == nullptr || !WsClient->canSend () || !Client.second.Subscriptions.empty ()) {
+          continue;
+        }
+        if (_Push && ActMillis - Client.second.LastMillis < WsPushInterval) {
+          // Retry when the first deferred Client is allowed again
+          if (WsPushInterval - (ActMillis - Client.second.LastMillis) < Wait) {
+            Wait = WsPushInterval - (ActMillis - Client.second.LastMillis);
+          }
+          Deferred = true;
+          continue;
+        }
+        if (Client.second.Sequence == 0) {
+          // All Data after a Format-Switch, or every Cycle if the Callback has no Sequences
+          AsyncWebSocketSharedBuffer Buffer = getSnapshot (Client.second.MsgPack, Client.second.Sequence);
+          if (Client.second.MsgPack) {
+            WsClient->binary (Buffer);
+          } else {
+            WsClient->text (Buffer);
+          }
+          Client.second.LastMillis = ActMillis;
+          Sent = true;
+          continue;
+        }
+        if (!_Build.Built || _Build.Since != Client.second.Sequence) {
+          _Build.Changed = buildWsUpdate (Client.second.Sequence, *_Build.Data, _Build.Sequence);
+          _Build.Message = WsMessage_T ();
+          _Build.Since = Client.second.Sequence;
+          _Build.Built = true;
+        }
+        if (_Build.Changed) {
+          wsSend (WsClient, Client.second.MsgPack, _Build.Data->as<JsonVariantConst> (), _Build.Message);
+          Client.second.Sequence = _Build.Sequence;
+          Client.second.LastMillis = ActMillis;
+          Sent = true;
+        }
+      }
+      if (Deferred) {
+        wsSchedulePush (ActMillis, Wait);
+      }
+      return Sent;
+    }
+
+    /**
+     * @brief Schedule a Push of the Changes, all Notifications within the Coalescing-Window end in one Push.
+     * Can be called from any Task, e.g. by the Change-Callback of the Function-Handler.
+     */
+    void Server::notifyChange () {
+      {
+        // New Clients get the Changes after their Snapshot by Sequence, only the GET-Answer is outdated
+        MutexLock Guard (SnapshotLock);
+        RestSnapshot.reset ();
+        ChangeNotified = true;
+      }
+      wsSchedulePush (millis (), JCA_IOT_SERVER_WS_COALESCE);
+    }
+
+    /**
+     * @brief Schedule a Push if none is pending, a pending one keeps its Time.
+     * Time and Delay are written before the Flag and all three under the Lock,
+     * so the Loop never sees a pending Push with the Time of an older one.
+     *
+     * @param _Millis Time of the Notification
+     * @param _Delay Time to wait before the Push
+     */
+    void Server::wsSchedulePush (unsigned long _Millis, uint32_t _Delay) {
+      MutexLock Guard (WsPushLock);
+      if (!WsPushPending) {
+        WsPushMillis = _Millis;
+        WsPushDelay = _Delay;
+        WsPushPending = true;
+      }
+    }
+
+    /**
+     * @brief Check and clear a pending Push. It is cleared before the Push is built,
+     * so a Notification during the Push schedules the next one and is never lost.
+     *
+     * @param _Millis current Time
+     * @return true Push is due now
+     */
+    bool Server::wsPushDue (unsigned long _Millis) {
+      if (!WsPushPending) {
+        return false;
+      }
+      MutexLock Guard (WsPushLock);
+      if (!WsPushPending || _Millis - WsPushMillis < WsPushDelay) {
+        return false;
+      }
+      WsPushPending = false;
       return true;
     }
+
+    /**
+     * @brief Replace the Subscriptions of a Client, each one starts with all its Data
+     *
+     * @param _Client State of the Client
+     * @param _Subscriptions List of {"function":..,"tag":..,"interval":..}, empty to return to the common Update
+     * @return true Client has Subscriptions
+     */
+    bool Server::wsSubscribe (WsClient_T &_Client, JsonArray _Subscriptions) {
+      _Client.Subscriptions.clear ();
+      _Client.Sequence = 0;
+      for (JsonObject Entry : _Subscriptions) {
+        if (_Client.Subscriptions.size () >= JCA_IOT_SERVER_WS_MAX_SUBSCRIPTIONS) {
+          Debug.println (FLAG_ERROR, true, ObjectName, __func__, "Too many Subscriptions");
+          break;
+        }
+        WsSubscription_T Subscription;
+        Subscription.Function = Entry[JCA_IOT_SERVER_WS_FUNCTION] | "";
+        Subscription.Tag = Entry[JCA_IOT_SERVER_WS_TAG] | "";
+        Subscription.Interval = Entry[JCA_IOT_SERVER_WS_INTERVAL] | WsUpdateCycle;
+        if (Subscription.Interval < JCA_IOT_SERVER_WS_MIN_INTERVAL) {
+          Subscription.Interval = JCA_IOT_SERVER_WS_MIN_INTERVAL;
+        }
+        Subscription.Sequence = 0;
+        Subscription.LastMillis = millis () - Subscription.Interval;
+        _Client.Subscriptions.push_back (Subscription);
+      }
+      Debug.print (FLAG_TRAFFIC, true, ObjectName, __func__, "Subscriptions: ");
+      Debug.println (FLAG_TRAFFIC, true, ObjectName, __func__, _Client.Subscriptions.size ());
+      return !_Client.Subscriptions.empty ();
+    }
+
+    /**
+     * @brief Send the due Subscriptions, all Changes of a Client are merged into one Message.
+     * A busy Client keeps the Sequences and gets the missed Changes later.
+     *
+     * @return true at least one Message was sent
+     */
+    bool Server::doWsSubscriptions () {
+      unsigned long ActMillis = millis ();
+      PooledDoc DataDoc (DocPool::Requests);
+      PooledDoc PartDoc (DocPool::Requests);
+      JsonDocument &Data = *DataDoc;
+      JsonDocument &Part = *PartDoc;
+      bool Sent = false;
+      MutexLock Guard (WsClientLock);
+      for (std::pair<const uint32_t, WsClient_T> &Client : WsClients) {
+        if (Client.second.Subscriptions.empty ()) {
+          continue;
+        }
+        AsyncWebSocketClient *WsClient = WebSocketObject.client (Client.first);
+        if (WsClient == nullptr || !WsClient->canSend ()) {
+          continue;
+        }
+        Data.clear ();
+        bool Changed = false;
+        for (WsSubscription_T &Subscription : Client.second.Subscriptions) {
+          if (ActMillis - Subscription.LastMillis < Subscription.Interval) {
+            continue;
+          }
+          Subscription.LastMillis = ActMillis;
+          uint32_t Sequence;
+          const char *Function = Subscription.Function.length () > 0 ? Subscription.Function.c_str () : nullptr;
+          const char *Tag = Subscription.Tag.length () > 0 ? Subscription.Tag.c_str () : nullptr;
+          if (buildWsUpdate (Subscription.Sequence, Part, Sequence, Function, Tag)) {
+            mergeJson (Data.as<JsonVariant> (), Part.as<JsonVariantConst> ());
+            Subscription.Sequence = Sequence;
+            Changed = true;
+          }
+        }
+        if (Changed) {
+          WsMessage_T Message;
+          wsSend (WsClient, Client.second.MsgPack, Data.as<JsonVariantConst> (), Message);
+          Sent = true;
+        }
+      }
+      return Sent;
+    }
+
+    /**
+     * @brief Copy the Source into the Target, Objects existing in both are merged
+     *
+     * @param _Target Target, a Value is overwritten
+     * @param _Source Source
+     */
+    void Server::mergeJson (JsonVariant _Target, JsonVariantConst _Source) {
+      if (!_Source.is<JsonObjectConst> () || !_Target.is<JsonObject> ()) {
+        _Target.set (_Source);
+        return;
+      }
+      JsonObject Target = _Target.as<JsonObject> ();
+      for (JsonPairConst Pair : _Source.as<JsonObjectConst> ()) {
+        if (Target[Pair.key ()].is<JsonObject> () && Pair.value ().is<JsonObjectConst> ()) {
+          mergeJson (Target[Pair.key ()].as<JsonVariant> (), Pair.value ());
+        } else {
+          Target[Pair.key ()] = Pair.value ();
+        }
+      }
+    }
   }
 }
@@ -5,8 +5,10 @@
  * - Check Connection State
  * - Create AP if not possible to connect to a WiFi
  * - Check configured WiFi after WatchDog is in AP Mode
- * @version 0.1
+ * @version 0.2
  * @date 2022-09-03
+ * @changelog
+ * - [0.2] 2026-10-17: Name and Style of the Site are defined by the Server
  *
  * Copyright Jochen Cabrera 2022
  * Apache License
@@ -444,9 +446,6 @@ namespace JCA {
      * @return String Replace String
      */
     String WiFiConnect::replaceWildcards (const String &var) {
-      if (var == "NAME") {
-        return F ("WiFi Connect");
-      }
       if (var == "SSID") {
         return String (Ssid);
       }
@@ -462,9 +461,6 @@ namespace JCA {
       if (var == "SUBNET") {
         return Gateway.toString ();
       }
-      if (var == "STYLE") {
-        return F (":root{--ColorWiFi:var(--contrast)}");
-      }
       return String ();
     }
 
@@ -0,0 +1,118 @@
+/**
+ * @file JCA_SYS_Arena.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Chunk-Arena for the long living Objects created by the Setup (Functions, Tags, Links)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Arena.h>
+#include <new>
+#include <stdlib.h>
+
+namespace JCA {
+  namespace SYS {
+    Arena Arena::Objects;
+
+    Arena::Arena () {
+      Chunks = nullptr;
+      ChunkCount = 0;
+      LiveCount = 0;
+    }
+
+    /**
+     * @brief Get Memory for an Object, from the current Chunk or a new one
+     *
+     * @param _Size Size of the Object
+     * @return void* Memory aligned to 8 Bytes, never nullptr (behaves like new if the Heap is full)
+     */
+    void *Arena::allocate (size_t _Size) {
+      size_t Size = ObjectHeader + ((_Size + Align - 1) & ~(Align - 1));
+      Object_T *Object;
+      if (Size > JCA_SYS_ARENA_CHUNK_SIZE - ChunkHeader) {
+        // Too big for a Chunk
+        Object = static_cast<Object_T *> (malloc (Size));
+        if (Object == nullptr) {
+          outOfMemory ();
+        }
+        Object->Chunk = nullptr;
+      } else {
+        if (Chunks == nullptr || Chunks->Used + Size > JCA_SYS_ARENA_CHUNK_SIZE - ChunkHeader) {
+          Chunk_T *Chunk = static_cast<Chunk_T *> (malloc (JCA_SYS_ARENA_CHUNK_SIZE));
+          if (Chunk == nullptr) {
+            outOfMemory ();
+          }
+          Chunk->Prev = nullptr;
+          Chunk->Next = Chunks;
+          Chunk->Used = 0;
+          Chunk->Live = 0;
+          if (Chunks) {
+            Chunks->Prev = Chunk;
+          }
+          Chunks = Chunk;
+          ChunkCount++;
+        }
+        Object = reinterpret_cast<Object_T *> (reinterpret_cast<uint8_t *> (Chunks) + ChunkHeader + Chunks->Used);
+        Object->Chunk = Chunks;
+        Chunks->Used += Size;
+        Chunks->Live++;
+      }
+      Object->Owner = this;
+      LiveCount++;
+      return reinterpret_cast<uint8_t *> (Object) + ObjectHeader;
+    }
+
+    /**
+     * @brief Release the Memory of an Object, the Chunk is freed with its last Object.
+     * The current Chunk is only rewound, so the next Setup starts without a new malloc.
+     *
+     * @param _Ptr Memory returned by allocate
+     */
+    void Arena::release (void *_Ptr) {
+      if (_Ptr == nullptr) {
+        return;
+      }
+      Object_T *Object = reinterpret_cast<Object_T *> (static_cast<uint8_t *> (_Ptr) - ObjectHeader);
+      Chunk_T *Chunk = Object->Chunk;
+      Arena *Owner = Object->Owner;
+      Owner->LiveCount--;
+      if (Chunk == nullptr) {
+        free (Object);
+        return;
+      }
+      Chunk->Live--;
+      if (Chunk->Live == 0) {
+        if (Chunk == Owner->Chunks) {
+          Chunk->Used = 0;
+        } else {
+          Owner->freeChunk (Chunk);
+        }
+      }
+    }
+
+    void Arena::outOfMemory () {
+#if defined(__cpp_exceptions)
+      throw std::bad_alloc ();
+#else
+      abort ();
+#endif
+    }
+
+    void Arena::freeChunk (Chunk_T *_Chunk) {
+      if (_Chunk->Prev) {
+        _Chunk->Prev->Next = _Chunk->Next;
+      } else {
+        Chunks = _Chunk->Next;
+      }
+      if (_Chunk->Next) {
+        _Chunk->Next->Prev = _Chunk->Prev;
+      }
+      ChunkCount--;
+      free (_Chunk);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file JCA_SYS_Arena.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Chunk-Arena for the long living Objects created by the Setup (Functions, Tags, Links)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_ARENA_
+#define _JCA_SYS_ARENA_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Size of one Chunk, all Chunks have the same Size so a freed Chunk fits exactly into the next one
+#ifndef JCA_SYS_ARENA_CHUNK_SIZE
+  #define JCA_SYS_ARENA_CHUNK_SIZE 2048
+#endif
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Bump-Allocator on equal sized Chunks.
+     * Each Chunk counts its living Objects and is freed in one step when the last one is deleted,
+     * so a Reinit does not leave small holes on the Heap. Objects bigger than a Chunk use malloc.
+     * Not thread safe, only use it from the Setup.
+     */
+    class Arena {
+    private:
+      struct Chunk_T {
+        Chunk_T *Next;
+        Chunk_T *Prev;
+        uint16_t Used; ///< Bytes used behind the Header
+        uint16_t Live; ///< Amount of living Objects
+      };
+      struct Object_T {
+        Chunk_T *Chunk; ///< nullptr for big Objects allocated by malloc
+        Arena *Owner;
+      };
+      static const size_t Align = 8;
+      static const size_t ChunkHeader = (sizeof (Chunk_T) + Align - 1) & ~(Align - 1);
+      static const size_t ObjectHeader = (sizeof (Object_T) + Align - 1) & ~(Align - 1);
+
+      Chunk_T *Chunks;  ///< List of all Chunks, the first one is the current
+      uint16_t ChunkCount;
+      uint32_t LiveCount;
+
+      void freeChunk (Chunk_T *_Chunk);
+      static void outOfMemory ();
+
+    public:
+      static Arena Objects; ///< Arena for Functions, Tags and Links
+
+      Arena ();
+      void *allocate (size_t _Size);
+      static void release (void *_Ptr);
+      uint16_t getChunkCount () const { return ChunkCount; };
+      uint32_t getLiveCount () const { return LiveCount; };
+    };
+  }
+}
+
+#endif
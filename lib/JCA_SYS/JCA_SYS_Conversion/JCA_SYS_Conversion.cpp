@@ -70,6 +70,106 @@ namespace JCA {
       }
       return Result;
     }
+
+    /**
+     * @brief Compare a Text with a Pattern, '*' matches any Sequence (also empty) and '?' one Character
+     *
+     * @param _Pattern Pattern, nullptr matches everything
+     * @param _Text Text to check
+     * @return true Text matches the Pattern
+     */
+    bool MatchPattern (const char *_Pattern, const char *_Text) {
+      if (_Pattern == nullptr) {
+        return true;
+      }
+      if (_Text == nullptr) {
+        _Text = "";
+      }
+      // Position of the last '*', to step back if the rest does not match
+      const char *Star = nullptr;
+      const char *Retry = nullptr;
+      while (*_Text != '\0') {
+        if (*_Pattern == '*') {
+          Star = _Pattern++;
+          Retry = _Text;
+        } else if (*_Pattern == '?' || *_Pattern == *_Text) {
+          _Pattern++;
+          _Text++;
+        } else if (Star != nullptr) {
+          _Pattern = Star + 1;
+          _Text = ++Retry;
+        } else {
+          return false;
+        }
+      }
+      while (*_Pattern == '*') {
+        _Pattern++;
+      }
+      return *_Pattern == '\0';
+    }
+
+    static const uint32_t Crc32Polynom = 0xEDB88320UL; ///< reflected Polynom of gzip
+
+    /**
+     * @brief CRC32 as used by gzip, bitwise without Table as it is only used for short Texts
+     *
+     * @param _Data Data
+     * @param _Length Length of the Data
+     * @param _Crc CRC of the previous Data, 0 for the Start
+     * @return uint32_t CRC including the Data
+     */
+    uint32_t Crc32 (const uint8_t *_Data, size_t _Length, uint32_t _Crc) {
+      _Crc = ~_Crc;
+      for (size_t i = 0; i < _Length; i++) {
+        _Crc ^= _Data[i];
+        for (uint8_t b = 0; b < 8; b++) {
+          _Crc = (_Crc & 1) ? (_Crc >> 1) ^ Crc32Polynom : _Crc >> 1;
+        }
+      }
+      return ~_Crc;
+    }
+
+    /**
+     * @brief Product of two Polynoms modulo the CRC-Polynom (reflected Bit-Order)
+     */
+    static uint32_t Crc32Multiply (uint32_t _A, uint32_t _B) {
+      uint32_t Mask = 1UL << 31;
+      uint32_t Product = 0;
+      for (;;) {
+        if (_A & Mask) {
+          Product ^= _B;
+          if ((_A & (Mask - 1)) == 0) {
+            break;
+          }
+        }
+        Mask >>= 1;
+        _B = (_B & 1) ? (_B >> 1) ^ Crc32Polynom : _B >> 1;
+      }
+      return Product;
+    }
+
+    /**
+     * @brief CRC32 of two Parts, calculated from the CRC of each Part (like crc32_combine of zlib)
+     *
+     * @param _Crc1 CRC of the first Part
+     * @param _Crc2 CRC of the second Part
+     * @param _Length2 Length of the second Part
+     * @return uint32_t CRC of both Parts
+     */
+    uint32_t Crc32Combine (uint32_t _Crc1, uint32_t _Crc2, size_t _Length2) {
+      // Shift the first CRC by x^(8 * Length2), using the Squares x^(2^k) of x
+      uint32_t Power = 1UL << 30; // x^1
+      uint32_t Shift = 1UL << 31; // x^0
+      size_t Bits = _Length2 * 8;
+      while (Bits) {
+        if (Bits & 1) {
+          Shift = Crc32Multiply (Power, Shift);
+        }
+        Power = Crc32Multiply (Power, Power);
+        Bits >>= 1;
+      }
+      return Crc32Multiply (Shift, _Crc1) ^ _Crc2;
+    }
   }
 }
 
@@ -2,8 +2,11 @@
  * @file JCA_SYS_Conversion.h
  * @author JCA (https://github.com/ichok)
  * @brief Collection of Conversion Functions
- * @version 1.0
+ * @version 1.2
  * @date 2024-04-14
+ * @changelog
+ * - [1.1] 2026-10-17: MatchPattern for Names with Wildcards
+ * - [1.2] 2026-10-17: CRC32 of gzip, also combined from the CRCs of two Parts
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -20,6 +23,9 @@ namespace JCA {
     bool HexStringToByteArray (String _HexString, uint8_t *_ByteArray, uint8_t _Length);
     uint8_t HexCharToInt (char _HexChar);
     String ByteArrayToHexString (uint8_t *_ByteArray, uint8_t _Length);
+    bool MatchPattern (const char *_Pattern, const char *_Text);
+    uint32_t Crc32 (const uint8_t *_Data, size_t _Length, uint32_t _Crc = 0);
+    uint32_t Crc32Combine (uint32_t _Crc1, uint32_t _Crc2, size_t _Length2);
   }
 }
 
@@ -0,0 +1,223 @@
+/**
+ * @file JCA_SYS_DocPool.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Pool of JsonDocuments with own Arenas, for the short living Documents of the Request-Handling
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_DocPool.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace JCA {
+  namespace SYS {
+    DocPool DocPool::Requests (JCA_SYS_DOCPOOL_COUNT, JCA_SYS_DOCPOOL_ARENA_SIZE);
+
+    DocArena::DocArena () {
+      Buffer = nullptr;
+      Size = 0;
+      Used = 0;
+      Last = NoBlock;
+      MaxUsed = 0;
+      Overflows = 0;
+    }
+
+    DocArena::~DocArena () {
+      free (Buffer);
+    }
+
+    /**
+     * @brief Allocate the Buffer, without it every Block comes from the Heap
+     *
+     * @param _Size Size of the Buffer
+     * @return true Buffer allocated
+     */
+    bool DocArena::begin (size_t _Size) {
+      Buffer = static_cast<uint8_t *> (malloc (_Size));
+      Size = (Buffer != nullptr) ? _Size : 0;
+      reset ();
+      return Buffer != nullptr;
+    }
+
+    bool DocArena::owns (void *_Ptr) const {
+      return _Ptr >= Buffer && _Ptr < Buffer + Size;
+    }
+
+    void *DocArena::allocate (size_t _Size) {
+      size_t Need = Header + align (_Size);
+      if (Used + Need > Size) {
+        Overflows++;
+        return malloc (_Size);
+      }
+      *reinterpret_cast<size_t *> (Buffer + Used) = _Size;
+      Last = Used;
+      Used += Need;
+      if (Used > MaxUsed) {
+        MaxUsed = Used;
+      }
+      return Buffer + Last + Header;
+    }
+
+    void DocArena::deallocate (void *_Ptr) {
+      if (!owns (_Ptr)) {
+        free (_Ptr);
+        return;
+      }
+      if (Last != NoBlock && _Ptr == Buffer + Last + Header) {
+        Used = Last;
+        Last = NoBlock;
+      }
+    }
+
+    void *DocArena::reallocate (void *_Ptr, size_t _Size) {
+      if (_Ptr == nullptr) {
+        return allocate (_Size);
+      }
+      if (!owns (_Ptr)) {
+        return realloc (_Ptr, _Size);
+      }
+      uint8_t *Block = static_cast<uint8_t *> (_Ptr) - Header;
+      size_t &BlockSize = *reinterpret_cast<size_t *> (Block);
+      bool IsLast = (Last != NoBlock && Block == Buffer + Last);
+      if (IsLast && Last + Header + align (_Size) <= Size) {
+        // Grow or shrink the last Block in place
+        BlockSize = _Size;
+        Used = Last + Header + align (_Size);
+        if (Used > MaxUsed) {
+          MaxUsed = Used;
+        }
+        return _Ptr;
+      }
+      if (_Size <= BlockSize) {
+        BlockSize = _Size;
+        return _Ptr;
+      }
+      // The old Block stays unused until reset
+      void *New = allocate (_Size);
+      if (New != nullptr) {
+        memcpy (New, _Ptr, BlockSize);
+      }
+      return New;
+    }
+
+    /**
+     * @brief Give back all Blocks, only call it if the Document is empty
+     */
+    void DocArena::reset () {
+      Used = 0;
+      Last = NoBlock;
+    }
+
+    PooledDoc::PooledDoc (DocPool &_Pool) {
+      Pool = &_Pool;
+      Slot = Pool->take ();
+      Doc = (Slot >= 0) ? &Pool->Slots[Slot].Doc : new JsonDocument ();
+    }
+
+    PooledDoc::PooledDoc (PooledDoc &&_Other) {
+      Pool = _Other.Pool;
+      Slot = _Other.Slot;
+      Doc = _Other.Doc;
+      _Other.Pool = nullptr;
+      _Other.Doc = nullptr;
+    }
+
+    PooledDoc::~PooledDoc () {
+      if (Pool == nullptr) {
+        return;
+      }
+      if (Slot >= 0) {
+        Pool->giveBack (Slot);
+      } else {
+        delete Doc;
+      }
+    }
+
+    DocPool::DocPool (uint8_t _Count, size_t _ArenaSize) {
+      Slots = nullptr;
+      Count = _Count;
+      ArenaSize = _ArenaSize;
+      InUse = 0;
+      MaxInUse = 0;
+      Borrows = 0;
+      Misses = 0;
+    }
+
+    DocPool::~DocPool () {
+      delete[] Slots;
+    }
+
+    /**
+     * @brief Reserve a free Slot, the Slots are created with the first Call
+     *
+     * @return int8_t Index of the Slot, -1 if all are in use
+     */
+    int8_t DocPool::take () {
+      MutexLock Guard (Lock);
+      if (Slots == nullptr) {
+        Slots = new Slot_T[Count];
+        for (uint8_t i = 0; i < Count; i++) {
+          Slots[i].Arena.begin (ArenaSize);
+        }
+      }
+      Borrows++;
+      for (uint8_t i = 0; i < Count; i++) {
+        if (!Slots[i].Used) {
+          Slots[i].Used = true;
+          InUse++;
+          if (InUse > MaxInUse) {
+            MaxInUse = InUse;
+          }
+          return i;
+        }
+      }
+      Misses++;
+      return -1;
+    }
+
+    /**
+     * @brief Clear the Document and rewind its Arena, then the Slot is free again
+     *
+     * @param _Slot Index of the Slot
+     */
+    void DocPool::giveBack (int8_t _Slot) {
+      Slots[_Slot].Doc.clear ();
+      Slots[_Slot].Arena.reset ();
+      MutexLock Guard (Lock);
+      Slots[_Slot].Used = false;
+      InUse--;
+    }
+
+    /**
+     * @brief Usage of the Pool, the High-Water-Marks are kept since the Start
+     *
+     * @param _Stats Object for the Statistic
+     */
+    void DocPool::getStats (JsonObject _Stats) {
+      MutexLock Guard (Lock);
+      _Stats["count"] = Count;
+      _Stats["inUse"] = InUse;
+      _Stats["maxInUse"] = MaxInUse;
+      _Stats["borrows"] = Borrows;
+      _Stats["misses"] = Misses;
+      _Stats["arenaSize"] = ArenaSize;
+      size_t MaxUsed = 0;
+      uint32_t Overflows = 0;
+      if (Slots != nullptr) {
+        for (uint8_t i = 0; i < Count; i++) {
+          if (Slots[i].Arena.getMaxUsed () > MaxUsed) {
+            MaxUsed = Slots[i].Arena.getMaxUsed ();
+          }
+          Overflows += Slots[i].Arena.getOverflows ();
+        }
+      }
+      _Stats["arenaMaxUsed"] = MaxUsed;
+      _Stats["overflows"] = Overflows;
+    }
+  }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file JCA_SYS_DocPool.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Pool of JsonDocuments with own Arenas, for the short living Documents of the Request-Handling
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_DOCPOOL_
+#define _JCA_SYS_DOCPOOL_
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <JCA_SYS_Task.h>
+
+// Amount of Documents and the Arena-Size of each, a Document that needs more Memory continues on the Heap
+#ifndef JCA_SYS_DOCPOOL_COUNT
+  #define JCA_SYS_DOCPOOL_COUNT 4
+#endif
+#ifndef JCA_SYS_DOCPOOL_ARENA_SIZE
+  #define JCA_SYS_DOCPOOL_ARENA_SIZE 3072
+#endif
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief ArduinoJson-Allocator on a fixed Buffer. Memory is only taken from the End,
+     * so deallocate just rewinds the last Block and everything else is given back by reset.
+     * The last Block grows in place, which fits the growing Strings of the Deserializer.
+     */
+    class DocArena : public ArduinoJson::Allocator {
+    private:
+      static const size_t Align = 8;
+      static const size_t Header = Align; ///< Size of the Block in front of each Block
+      static const size_t NoBlock = (size_t)-1;
+      uint8_t *Buffer;
+      size_t Size;
+      size_t Used;
+      size_t Last; ///< Offset of the Header of the last Block, NoBlock if it was released
+      size_t MaxUsed;
+      uint32_t Overflows;
+
+      bool owns (void *_Ptr) const;
+      static size_t align (size_t _Size) { return (_Size + Align - 1) & ~(Align - 1); };
+
+    public:
+      DocArena ();
+      ~DocArena ();
+      bool begin (size_t _Size);
+      void *allocate (size_t _Size) override;
+      void deallocate (void *_Ptr) override;
+      void *reallocate (void *_Ptr, size_t _Size) override;
+      void reset ();
+      size_t getSize () const { return Size; };
+      size_t getMaxUsed () const { return MaxUsed; };
+      uint32_t getOverflows () const { return Overflows; };
+    };
+
+    class DocPool;
+
+    /**
+     * @brief Borrowed Document, it is cleared and given back to the Pool at the End of the Scope
+     */
+    class PooledDoc {
+    private:
+      DocPool *Pool;
+      int8_t Slot;      ///< -1 if the Pool was empty
+      JsonDocument *Doc;
+
+    public:
+      PooledDoc (DocPool &_Pool);
+      PooledDoc (PooledDoc &&_Other);
+      ~PooledDoc ();
+      PooledDoc (const PooledDoc &) = delete;
+      PooledDoc &operator= (const PooledDoc &) = delete;
+      JsonDocument &operator* () { return *Doc; };
+      JsonDocument *operator-> () { return Doc; };
+    };
+
+    /**
+     * @brief Fixed Set of Documents, the Arenas are allocated with the first Borrow and never freed.
+     * Borrow and give back are thread safe, the Document itself belongs to the Borrower.
+     * If all Documents are borrowed a Heap-Document is used, counted as Miss.
+     */
+    class DocPool {
+      friend class PooledDoc;
+
+    private:
+      struct Slot_T {
+        DocArena Arena;
+        JsonDocument Doc;
+        bool Used;
+        Slot_T () : Doc (&Arena), Used (false) {};
+      };
+      Slot_T *Slots;
+      uint8_t Count;
+      size_t ArenaSize;
+      Mutex Lock;
+      uint8_t InUse;
+      uint8_t MaxInUse;
+      uint32_t Borrows;
+      uint32_t Misses;
+
+      int8_t take ();
+      void giveBack (int8_t _Slot);
+
+    public:
+      static DocPool Requests; ///< Pool for the Documents of the Server and its Callbacks
+
+      DocPool (uint8_t _Count, size_t _ArenaSize);
+      ~DocPool ();
+      PooledDoc borrow () { return PooledDoc (*this); };
+      void getStats (JsonObject _Stats);
+    };
+  }
+}
+
+#endif
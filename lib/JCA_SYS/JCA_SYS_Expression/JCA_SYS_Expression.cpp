@@ -0,0 +1,436 @@
+/**
+ * @file JCA_SYS_Expression.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Arithmetic Expression, compiled once into a Stack-Bytecode and evaluated on floats
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Expression.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define JCA_SYS_EXPRESSION_MAX_DEPTH 64
+#define JCA_SYS_EXPRESSION_MAX_CONSTANTS 255
+// Parentheses, Function-Calls and Signs in a row, each Level recurses through the Parser
+#ifndef JCA_SYS_EXPRESSION_MAX_NESTING
+  #define JCA_SYS_EXPRESSION_MAX_NESTING 16
+#endif
+
+namespace JCA {
+  namespace SYS {
+    Expression::Expression () {
+      Pos = nullptr;
+      Start = nullptr;
+      InputCount = 0;
+      Depth = 0;
+      MaxDepth = 0;
+      Nesting = 0;
+    }
+
+    /**
+     * @brief Parse the Expression and create the Bytecode
+     *
+     * @param _Expr Expression-Text
+     * @param _InputCount Amount of usable Inputs, in0 to in(_InputCount-1)
+     * @return true Expression is valid and can be evaluated
+     * @return false Syntax-Error, the Message is available by getError
+     */
+    bool Expression::compile (const char *_Expr, uint8_t _InputCount) {
+      Code.clear ();
+      Constants.clear ();
+      Stack.clear ();
+      Error = "";
+      InputCount = _InputCount;
+      Depth = 0;
+      MaxDepth = 0;
+      Nesting = 0;
+      Start = _Expr;
+      Pos = _Expr;
+
+      if (_Expr == nullptr) {
+        Error = "missing";
+        return false;
+      }
+      bool Done = parseOr ();
+      if (Done) {
+        skipSpaces ();
+        if (*Pos != '\0') {
+          Done = fail ("unexpected character");
+        }
+      }
+      Pos = nullptr;
+      Start = nullptr;
+      if (!Done) {
+        Code.clear ();
+        Constants.clear ();
+        return false;
+      }
+      Code.shrink_to_fit ();
+      Constants.shrink_to_fit ();
+      Stack.resize (MaxDepth);
+      return true;
+    }
+
+    /**
+     * @brief Run the Bytecode
+     *
+     * @param _Inputs Input-Values, at least as many as given to compile
+     * @return float Result, 0.0 if the Expression is not valid
+     */
+    float Expression::evaluate (const float *_Inputs) {
+      if (Code.empty ()) {
+        return 0.0f;
+      }
+      float *Top = Stack.data () - 1;
+      for (const Op_T &Op : Code) {
+        switch (Op.Code) {
+        case OpConst:
+          *(++Top) = Constants[Op.Arg];
+          break;
+        case OpInput:
+          *(++Top) = _Inputs[Op.Arg];
+          break;
+        case OpNeg:
+          *Top = -*Top;
+          break;
+        case OpNot:
+          *Top = (*Top == 0.0f) ? 1.0f : 0.0f;
+          break;
+        case OpAdd:
+          Top--;
+          Top[0] = Top[0] + Top[1];
+          break;
+        case OpSub:
+          Top--;
+          Top[0] = Top[0] - Top[1];
+          break;
+        case OpMul:
+          Top--;
+          Top[0] = Top[0] * Top[1];
+          break;
+        case OpDiv:
+          Top--;
+          Top[0] = (Top[1] == 0.0f) ? 0.0f : Top[0] / Top[1];
+          break;
+        case OpMod:
+          Top--;
+          Top[0] = (Top[1] == 0.0f) ? 0.0f : fmodf (Top[0], Top[1]);
+          break;
+        case OpLt:
+          Top--;
+          Top[0] = (Top[0] < Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpLe:
+          Top--;
+          Top[0] = (Top[0] <= Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpGt:
+          Top--;
+          Top[0] = (Top[0] > Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpGe:
+          Top--;
+          Top[0] = (Top[0] >= Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpEq:
+          Top--;
+          Top[0] = (Top[0] == Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpNe:
+          Top--;
+          Top[0] = (Top[0] != Top[1]) ? 1.0f : 0.0f;
+          break;
+        case OpAnd:
+          Top--;
+          Top[0] = (Top[0] != 0.0f && Top[1] != 0.0f) ? 1.0f : 0.0f;
+          break;
+        case OpOr:
+          Top--;
+          Top[0] = (Top[0] != 0.0f || Top[1] != 0.0f) ? 1.0f : 0.0f;
+          break;
+        case OpMin:
+          Top--;
+          Top[0] = (Top[1] < Top[0]) ? Top[1] : Top[0];
+          break;
+        case OpMax:
+          Top--;
+          Top[0] = (Top[1] > Top[0]) ? Top[1] : Top[0];
+          break;
+        case OpAbs:
+          *Top = fabsf (*Top);
+          break;
+        case OpClamp:
+          Top -= 2;
+          if (Top[0] < Top[1]) {
+            Top[0] = Top[1];
+          } else if (Top[0] > Top[2]) {
+            Top[0] = Top[2];
+          }
+          break;
+        case OpIf:
+          Top -= 2;
+          Top[0] = (Top[0] != 0.0f) ? Top[1] : Top[2];
+          break;
+        }
+      }
+      return *Top;
+    }
+
+    void Expression::skipSpaces () {
+      while (*Pos == ' ' || *Pos == '\t') {
+        Pos++;
+      }
+    }
+
+    /**
+     * @brief Consume the Token if it follows the current Position
+     */
+    bool Expression::accept (const char *_Token) {
+      skipSpaces ();
+      size_t Length = strlen (_Token);
+      if (strncmp (Pos, _Token, Length) == 0) {
+        Pos += Length;
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief Append an Operation and track the Stack-Depth
+     *
+     * @param _Code Operation
+     * @param _StackChange Values pushed (positive) or removed (negative) by the Operation
+     * @param _Arg Index of the Constant or Input
+     */
+    bool Expression::emit (OpCode_T _Code, int8_t _StackChange, uint8_t _Arg) {
+      if (Depth + _StackChange > JCA_SYS_EXPRESSION_MAX_DEPTH) {
+        return fail ("too complex");
+      }
+      Depth += _StackChange;
+      if (Depth > MaxDepth) {
+        MaxDepth = Depth;
+      }
+      Code.push_back ({ _Code, _Arg });
+      return true;
+    }
+
+    bool Expression::fail (const char *_Message) {
+      if (Error.length () == 0) {
+        Error = String (_Message) + " at " + String (Pos - Start);
+      }
+      return false;
+    }
+
+    bool Expression::parseOr () {
+      if (!parseAnd ()) {
+        return false;
+      }
+      while (accept ("||")) {
+        if (!parseAnd () || !emit (OpOr, -1)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool Expression::parseAnd () {
+      if (!parseCompare ()) {
+        return false;
+      }
+      while (accept ("&&")) {
+        if (!parseCompare () || !emit (OpAnd, -1)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool Expression::parseCompare () {
+      if (!parseSum ()) {
+        return false;
+      }
+      while (true) {
+        OpCode_T Op;
+        if (accept ("<=")) {
+          Op = OpLe;
+        } else if (accept (">=")) {
+          Op = OpGe;
+        } else if (accept ("==")) {
+          Op = OpEq;
+        } else if (accept ("!=")) {
+          Op = OpNe;
+        } else if (accept ("<")) {
+          Op = OpLt;
+        } else if (accept (">")) {
+          Op = OpGt;
+        } else {
+          return true;
+        }
+        if (!parseSum () || !emit (Op, -1)) {
+          return false;
+        }
+      }
+    }
+
+    bool Expression::parseSum () {
+      if (!parseProduct ()) {
+        return false;
+      }
+      while (true) {
+        OpCode_T Op;
+        if (accept ("+")) {
+          Op = OpAdd;
+        } else if (accept ("-")) {
+          Op = OpSub;
+        } else {
+          return true;
+        }
+        if (!parseProduct () || !emit (Op, -1)) {
+          return false;
+        }
+      }
+    }
+
+    bool Expression::parseProduct () {
+      if (!parseUnary ()) {
+        return false;
+      }
+      while (true) {
+        OpCode_T Op;
+        if (accept ("*")) {
+          Op = OpMul;
+        } else if (accept ("/")) {
+          Op = OpDiv;
+        } else if (accept ("%")) {
+          Op = OpMod;
+        } else {
+          return true;
+        }
+        if (!parseUnary () || !emit (Op, -1)) {
+          return false;
+        }
+      }
+    }
+
+    /**
+     * @brief Every nested Operand passes here, so the Nesting limits the Recursion of the whole Parser
+     */
+    bool Expression::parseUnary () {
+      if (Nesting >= JCA_SYS_EXPRESSION_MAX_NESTING) {
+        return fail ("too deeply nested");
+      }
+      Nesting++;
+      bool Done;
+      if (accept ("-")) {
+        Done = parseUnary () && emit (OpNeg, 0);
+      } else if (accept ("!")) {
+        Done = parseUnary () && emit (OpNot, 0);
+      } else if (accept ("+")) {
+        Done = parseUnary ();
+      } else {
+        Done = parsePrimary ();
+      }
+      Nesting--;
+      return Done;
+    }
+
+    bool Expression::parsePrimary () {
+      skipSpaces ();
+      if (accept ("(")) {
+        if (!parseOr ()) {
+          return false;
+        }
+        if (!accept (")")) {
+          return fail ("missing )");
+        }
+        return true;
+      }
+
+      // Number
+      if (isdigit ((unsigned char)*Pos) || *Pos == '.') {
+        char *End;
+        float Value = strtof (Pos, &End);
+        if (End == Pos) {
+          return fail ("invalid number");
+        }
+        Pos = End;
+        if (Constants.size () >= JCA_SYS_EXPRESSION_MAX_CONSTANTS) {
+          return fail ("too many constants");
+        }
+        Constants.push_back (Value);
+        return emit (OpConst, 1, Constants.size () - 1);
+      }
+
+      // Input or Function
+      if (isalpha ((unsigned char)*Pos)) {
+        const char *Name = Pos;
+        while (isalnum ((unsigned char)*Pos) || *Pos == '_') {
+          Pos++;
+        }
+        size_t Length = Pos - Name;
+        if (accept ("(")) {
+          return parseCall (Name, Length);
+        }
+        if (Length > 2 && strncmp (Name, "in", 2) == 0) {
+          long Index = strtol (Name + 2, nullptr, 10);
+          for (size_t i = 2; i < Length; i++) {
+            if (!isdigit ((unsigned char)Name[i])) {
+              Pos = Name;
+              return fail ("unknown name");
+            }
+          }
+          if (Index >= InputCount) {
+            Pos = Name;
+            return fail ("input not linked");
+          }
+          return emit (OpInput, 1, (uint8_t)Index);
+        }
+        Pos = Name;
+        return fail ("unknown name");
+      }
+      return fail ("value expected");
+    }
+
+    /**
+     * @brief Parse the Arguments of a Function, the open Parenthesis is already consumed
+     */
+    bool Expression::parseCall (const char *_Name, size_t _Length) {
+      struct Function_T {
+        const char *Name;
+        OpCode_T Code;
+        uint8_t Args;
+      };
+      static const Function_T FunctionList[] = {
+        { "min", OpMin, 2 },
+        { "max", OpMax, 2 },
+        { "abs", OpAbs, 1 },
+        { "clamp", OpClamp, 3 },
+        { "if", OpIf, 3 }
+      };
+      for (const Function_T &Function : FunctionList) {
+        if (strlen (Function.Name) != _Length || strncmp (Function.Name, _Name, _Length) != 0) {
+          continue;
+        }
+        for (uint8_t i = 0; i < Function.Args; i++) {
+          if (i > 0 && !accept (",")) {
+            return fail ("missing argument");
+          }
+          if (!parseOr ()) {
+            return false;
+          }
+        }
+        if (!accept (")")) {
+          return fail ("missing )");
+        }
+        return emit (Function.Code, 1 - Function.Args);
+      }
+      Pos = _Name;
+      return fail ("unknown function");
+    }
+  }
+}
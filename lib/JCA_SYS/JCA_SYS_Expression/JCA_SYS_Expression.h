@@ -0,0 +1,95 @@
+/**
+ * @file JCA_SYS_Expression.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Arithmetic Expression, compiled once into a Stack-Bytecode and evaluated on floats
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_EXPRESSION_
+#define _JCA_SYS_EXPRESSION_
+
+#include <Arduino.h>
+#include <vector>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Expression like "in0*0.5+in1" or "min(in0,in1)>10".
+     * Supported: Numbers, Inputs in0..inN, + - * / %, Comparisons < <= > >= == !=,
+     * Logic && || !, Parentheses and the Functions min, max, abs, clamp(x,lo,hi), if(c,a,b).
+     * Comparisons and Logic return 1.0 or 0.0. A Division by zero returns 0.0.
+     * All Memory is allocated by compile, evaluate works without allocation.
+     */
+    class Expression {
+    private:
+      enum OpCode_T : uint8_t {
+        OpConst,
+        OpInput,
+        OpNeg,
+        OpNot,
+        OpAdd,
+        OpSub,
+        OpMul,
+        OpDiv,
+        OpMod,
+        OpLt,
+        OpLe,
+        OpGt,
+        OpGe,
+        OpEq,
+        OpNe,
+        OpAnd,
+        OpOr,
+        OpMin,
+        OpMax,
+        OpAbs,
+        OpClamp,
+        OpIf
+      };
+      struct Op_T {
+        OpCode_T Code;
+        uint8_t Arg; ///< Index of the Constant or Input
+      };
+      std::vector<Op_T> Code;
+      std::vector<float> Constants;
+      std::vector<float> Stack;
+
+      // Parser state, only valid during compile
+      const char *Pos;
+      const char *Start;
+      uint8_t InputCount;
+      uint8_t Depth;
+      uint8_t MaxDepth;
+      uint8_t Nesting; ///< Active Levels of parseUnary
+      String Error;
+
+      void skipSpaces ();
+      bool accept (const char *_Token);
+      bool emit (OpCode_T _Code, int8_t _StackChange, uint8_t _Arg = 0);
+      bool fail (const char *_Message);
+      bool parseOr ();
+      bool parseAnd ();
+      bool parseCompare ();
+      bool parseSum ();
+      bool parseProduct ();
+      bool parseUnary ();
+      bool parsePrimary ();
+      bool parseCall (const char *_Name, size_t _Length);
+
+    public:
+      Expression ();
+      bool compile (const char *_Expr, uint8_t _InputCount);
+      float evaluate (const float *_Inputs);
+      bool isValid () const { return !Code.empty (); };
+      const String &getError () const { return Error; };
+      size_t getCodeSize () const { return Code.size (); };
+    };
+  }
+}
+
+#endif
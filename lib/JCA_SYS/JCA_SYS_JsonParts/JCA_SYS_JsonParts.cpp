@@ -0,0 +1,189 @@
+/**
+ * @file JCA_SYS_JsonParts.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Serialize a JsonDocument in Parts, e.g. for a Response that is filled while it is sent
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_JsonParts.h>
+#include <string.h>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Prepare the Serializer, the Data must live until everything is read
+     *
+     * @param _Data Data to serialize
+     * @param _MsgPack MessagePack instead of JSON
+     */
+    JsonParts::JsonParts (JsonVariantConst _Data, bool _MsgPack) : Data (_Data) {
+      MsgPack = _MsgPack;
+      Started = false;
+      Sent = 0;
+      MaxPending = 0;
+    }
+
+    /**
+     * @brief Length of the whole Output
+     *
+     * @return size_t Bytes
+     */
+    size_t JsonParts::measure () const {
+      return MsgPack ? measureMsgPack (Data) : measureJson (Data);
+    }
+
+    /**
+     * @brief Read the next Part of the Output
+     *
+     * @param _Out Buffer for the Part
+     * @param _MaxLen Size of the Buffer
+     * @return size_t Length of the Part, 0 at the End
+     */
+    size_t JsonParts::read (uint8_t *_Out, size_t _MaxLen) {
+      size_t Length = 0;
+      while (Length < _MaxLen) {
+        if (Sent == Pending.size ()) {
+          Pending.clear ();
+          Sent = 0;
+          if (!next ()) {
+            break;
+          }
+          if (Pending.size () > MaxPending) {
+            MaxPending = Pending.size ();
+          }
+          continue;
+        }
+        size_t Copy = Pending.size () - Sent;
+        if (Copy > _MaxLen - Length) {
+          Copy = _MaxLen - Length;
+        }
+        memcpy (_Out + Length, Pending.data () + Sent, Copy);
+        Sent += Copy;
+        Length += Copy;
+      }
+      return Length;
+    }
+
+    /**
+     * @brief Serialize the next Part into the empty Pending-Buffer: the Root, the next Member or Element
+     * of the innermost open Container, or its End
+     *
+     * @return true Pending was filled (it may stay empty, e.g. the End of a MessagePack-Object)
+     * @return false everything was serialized
+     */
+    bool JsonParts::next () {
+      if (!Started) {
+        Started = true;
+        value (Data);
+        return true;
+      }
+      if (Stack.empty ()) {
+        return false;
+      }
+      // Advance before value, it may push a Level and move the Stack
+      Level_T &Top = Stack.back ();
+      JsonVariantConst Value;
+      if (Top.Object) {
+        if (Top.Member == Top.MemberEnd) {
+          if (!MsgPack) {
+            Pending.push_back ('}');
+          }
+          Stack.pop_back ();
+          return true;
+        }
+        if (!MsgPack && !Top.First) {
+          Pending.push_back (',');
+        }
+        Key.set ((*Top.Member).key ());
+        serialize (Key.as<JsonVariantConst> ());
+        if (!MsgPack) {
+          Pending.push_back (':');
+        }
+        Value = (*Top.Member).value ();
+        ++Top.Member;
+      } else {
+        if (Top.Element == Top.ElementEnd) {
+          if (!MsgPack) {
+            Pending.push_back (']');
+          }
+          Stack.pop_back ();
+          return true;
+        }
+        if (!MsgPack && !Top.First) {
+          Pending.push_back (',');
+        }
+        Value = *Top.Element;
+        ++Top.Element;
+      }
+      Top.First = false;
+      value (Value);
+      return true;
+    }
+
+    /**
+     * @brief Serialize a Scalar, or the Header of a Container and open a Level for its Content
+     *
+     * @param _Value Value to serialize
+     */
+    void JsonParts::value (JsonVariantConst _Value) {
+      Level_T Level;
+      Level.First = true;
+      if (_Value.is<JsonObjectConst> ()) {
+        JsonObjectConst Object = _Value.as<JsonObjectConst> ();
+        Level.Object = true;
+        Level.Member = Object.begin ();
+        Level.MemberEnd = Object.end ();
+        header (Object.size (), 0x80, 0xDE, '{');
+      } else if (_Value.is<JsonArrayConst> ()) {
+        JsonArrayConst Array = _Value.as<JsonArrayConst> ();
+        Level.Object = false;
+        Level.Element = Array.begin ();
+        Level.ElementEnd = Array.end ();
+        header (Array.size (), 0x90, 0xDC, '[');
+      } else {
+        serialize (_Value);
+        return;
+      }
+      Stack.push_back (Level);
+    }
+
+    /**
+     * @brief Start of an Object or Array, the MessagePack-Header has the same Size-Classes as ArduinoJson
+     *
+     * @param _Count Elements inside the Container
+     * @param _Fix MessagePack-Code up to 15 Elements
+     * @param _Code16 MessagePack-Code with 16 Bit Size, the 32 Bit Code follows it
+     * @param _Open JSON-Character
+     */
+    void JsonParts::header (size_t _Count, uint8_t _Fix, uint8_t _Code16, char _Open) {
+      if (!MsgPack) {
+        Pending.push_back ((uint8_t)_Open);
+      } else if (_Count < 0x10) {
+        Pending.push_back (_Fix | (uint8_t)_Count);
+      } else if (_Count < 0x10000) {
+        Pending.push_back (_Code16);
+        Pending.push_back ((uint8_t)(_Count >> 8));
+        Pending.push_back ((uint8_t)_Count);
+      } else {
+        Pending.push_back (_Code16 + 1);
+        for (int8_t Shift = 24; Shift >= 0; Shift -= 8) {
+          Pending.push_back ((uint8_t)(_Count >> Shift));
+        }
+      }
+    }
+
+    void JsonParts::serialize (JsonVariantConst _Value) {
+      Writer_T Writer = { Pending };
+      if (MsgPack) {
+        serializeMsgPack (_Value, Writer);
+      } else {
+        serializeJson (_Value, Writer);
+      }
+    }
+  }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file JCA_SYS_JsonParts.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Serialize a JsonDocument in Parts, e.g. for a Response that is filled while it is sent
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_JSONPARTS_
+#define _JCA_SYS_JSONPARTS_
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Resumable Serializer for JSON or MessagePack. Objects and Arrays are walked with a Stack of Iterators,
+     * so each Part holds at most one Key with a Scalar or the Header of a nested Container.
+     * The Memory depends on the largest Scalar and the Depth, the Time on the Size of the Data.
+     * The Output is the same as of serializeJson or serializeMsgPack, measure returns its Length.
+     */
+    class JsonParts {
+    private:
+      struct Level_T {
+        bool Object;
+        bool First;
+        JsonObjectConstIterator Member;
+        JsonObjectConstIterator MemberEnd;
+        JsonArrayConstIterator Element;
+        JsonArrayConstIterator ElementEnd;
+      };
+      struct Writer_T {
+        std::vector<uint8_t> &Buffer;
+        size_t write (uint8_t _Byte) {
+          Buffer.push_back (_Byte);
+          return 1;
+        };
+        size_t write (const uint8_t *_Bytes, size_t _Size) {
+          Buffer.insert (Buffer.end (), _Bytes, _Bytes + _Size);
+          return _Size;
+        };
+      };
+      JsonVariantConst Data;
+      bool MsgPack;
+      bool Started;
+      std::vector<Level_T> Stack;   ///< open Containers, the innermost at the End
+      JsonDocument Key;             ///< Copy of the current Key, so it is escaped by ArduinoJson
+      std::vector<uint8_t> Pending; ///< serialized Part, the Capacity is kept for the next one
+      size_t Sent;                  ///< Bytes of Pending already read
+      size_t MaxPending;
+
+      bool next ();
+      void value (JsonVariantConst _Value);
+      void header (size_t _Count, uint8_t _Fix, uint8_t _Code16, char _Open);
+      void serialize (JsonVariantConst _Value);
+
+    public:
+      JsonParts (JsonVariantConst _Data, bool _MsgPack);
+      JsonParts (const JsonParts &) = delete;
+      JsonParts &operator= (const JsonParts &) = delete;
+      size_t measure () const;
+      size_t read (uint8_t *_Out, size_t _MaxLen);
+      size_t getMaxPending () const { return MaxPending; }; ///< Size of the largest Part so far
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file JCA_SYS_JsonWriter.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Streaming JSON-Writer with a small Buffer in front of a File (or any other Print)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_JsonWriter.h>
+#include <math.h>
+#include <stdio.h>
+
+namespace JCA {
+  namespace SYS {
+    JsonWriter::JsonWriter (Print &_Sink) : Sink (_Sink) {
+      Used = 0;
+      Filled = 0;
+      Depth = 0;
+      AfterKey = false;
+      Written = 0;
+    }
+
+    JsonWriter::~JsonWriter () {
+      flush ();
+    }
+
+    /**
+     * @brief Write the Buffer to the Sink
+     */
+    void JsonWriter::flush () {
+      if (Used > 0) {
+        Sink.write (reinterpret_cast<const uint8_t *> (Buffer), Used);
+        Written += Used;
+        Used = 0;
+      }
+    }
+
+    void JsonWriter::raw (const char *_Text, size_t _Length) {
+      while (_Length > 0) {
+        if (Used == sizeof (Buffer)) {
+          flush ();
+        }
+        size_t Part = sizeof (Buffer) - Used;
+        if (Part > _Length) {
+          Part = _Length;
+        }
+        memcpy (Buffer + Used, _Text, Part);
+        Used += Part;
+        _Text += Part;
+        _Length -= Part;
+      }
+    }
+
+    void JsonWriter::raw (char _Char) {
+      if (Used == sizeof (Buffer)) {
+        flush ();
+      }
+      Buffer[Used++] = _Char;
+    }
+
+    /**
+     * @brief Add the Comma in front of every Element except the first one of a Container
+     */
+    void JsonWriter::separate () {
+      if (AfterKey) {
+        AfterKey = false;
+        return;
+      }
+      uint32_t Bit = 1UL << Depth;
+      if (Filled & Bit) {
+        raw (',');
+      }
+      Filled |= Bit;
+    }
+
+    /**
+     * @brief Write a Text with Quotes, Quotes, Backslashes and Control-Characters are escaped
+     */
+    void JsonWriter::quoted (const char *_Text) {
+      static const char Hex[] = "0123456789abcdef";
+      raw ('"');
+      if (_Text != nullptr) {
+        const char *Start = _Text;
+        for (; *_Text != '\0'; _Text++) {
+          uint8_t Char = static_cast<uint8_t> (*_Text);
+          if (Char >= 0x20 && Char != '"' && Char != '\\') {
+            continue;
+          }
+          // Copy the unescaped Part in one Step
+          raw (Start, _Text - Start);
+          Start = _Text + 1;
+          raw ('\\');
+          switch (Char) {
+          case '"':
+          case '\\':
+            raw (static_cast<char> (Char));
+            break;
+          case '\n':
+            raw ('n');
+            break;
+          case '\r':
+            raw ('r');
+            break;
+          case '\t':
+            raw ('t');
+            break;
+          default:
+            raw ("u00", 3);
+            raw (Hex[Char >> 4]);
+            raw (Hex[Char & 0x0F]);
+            break;
+          }
+        }
+        raw (Start, _Text - Start);
+      }
+      raw ('"');
+    }
+
+    void JsonWriter::open (char _Char) {
+      separate ();
+      raw (_Char);
+      if (Depth < JCA_SYS_JSONWRITER_MAX_DEPTH - 1) {
+        Depth++;
+      }
+      Filled &= ~(1UL << Depth);
+    }
+
+    void JsonWriter::close (char _Char) {
+      if (Depth > 0) {
+        Depth--;
+      }
+      AfterKey = false;
+      raw (_Char);
+    }
+
+    void JsonWriter::beginObject () {
+      open ('{');
+    }
+
+    void JsonWriter::endObject () {
+      close ('}');
+    }
+
+    void JsonWriter::beginArray () {
+      open ('[');
+    }
+
+    void JsonWriter::endArray () {
+      close (']');
+    }
+
+    /**
+     * @brief Write the Key of the next Value inside an Object
+     *
+     * @param _Key Key, escaped like every Text
+     */
+    void JsonWriter::key (const char *_Key) {
+      separate ();
+      quoted (_Key);
+      raw (':');
+      AfterKey = true;
+    }
+
+    void JsonWriter::value (const char *_Value) {
+      separate ();
+      quoted (_Value);
+    }
+
+    void JsonWriter::null () {
+      separate ();
+      raw ("null", 4);
+    }
+
+    void JsonWriter::number (int32_t _Value) {
+      char Text[12];
+      separate ();
+      raw (Text, snprintf (Text, sizeof (Text), "%ld", static_cast<long> (_Value)));
+    }
+
+    void JsonWriter::number (uint32_t _Value) {
+      char Text[12];
+      separate ();
+      raw (Text, snprintf (Text, sizeof (Text), "%lu", static_cast<unsigned long> (_Value)));
+    }
+
+    /**
+     * @brief Write a Float, JSON has no Infinity or NaN, they are written as null
+     */
+    void JsonWriter::number (double _Value) {
+      if (!isfinite (_Value)) {
+        null ();
+        return;
+      }
+      char Text[24];
+      separate ();
+      raw (Text, snprintf (Text, sizeof (Text), "%.7g", _Value));
+    }
+  }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file JCA_SYS_JsonWriter.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Streaming JSON-Writer with a small Buffer in front of a File (or any other Print)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_JSONWRITER_
+#define _JCA_SYS_JSONWRITER_
+
+#include <Arduino.h>
+#include <type_traits>
+
+// Size of the Buffer, the Sink is written in Blocks of this Size
+#ifndef JCA_SYS_JSONWRITER_BUFFER_SIZE
+  #define JCA_SYS_JSONWRITER_BUFFER_SIZE 256
+#endif
+// Maximum Depth of nested Objects and Arrays
+#define JCA_SYS_JSONWRITER_MAX_DEPTH 32
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Writes JSON directly to a Sink without building Strings.
+     * Separators are added automatically, Texts are escaped.
+     * Keys inside Objects must be set by key before each Value.
+     */
+    class JsonWriter {
+    private:
+      Print &Sink;
+      char Buffer[JCA_SYS_JSONWRITER_BUFFER_SIZE];
+      size_t Used;
+      uint32_t Filled;  ///< Bit per Depth, set if the Container already has an Element
+      uint8_t Depth;
+      bool AfterKey;
+      size_t Written;
+
+      void separate ();
+      void raw (const char *_Text, size_t _Length);
+      void raw (char _Char);
+      void quoted (const char *_Text);
+      void open (char _Char);
+      void close (char _Char);
+      void number (int32_t _Value);
+      void number (uint32_t _Value);
+      void number (double _Value);
+
+    public:
+      JsonWriter (Print &_Sink);
+      ~JsonWriter ();
+      JsonWriter (const JsonWriter &) = delete;
+      JsonWriter &operator= (const JsonWriter &) = delete;
+
+      void beginObject ();
+      void endObject ();
+      void beginArray ();
+      void endArray ();
+      void key (const char *_Key);
+      void value (const char *_Value);
+      void value (const String &_Value) { value (_Value.c_str ()); };
+      void null ();
+
+      /**
+       * @brief Write a Number or Bool
+       *
+       * @tparam T arithmetic Datatype
+       * @param _Value Value to write
+       */
+      template <typename T>
+      void value (T _Value) {
+        static_assert (std::is_arithmetic<T>::value, "JsonWriter needs a Number, Bool or Text");
+        if constexpr (std::is_same<T, bool>::value) {
+          separate ();
+          raw (_Value ? "true" : "false", _Value ? 4 : 5);
+        } else if constexpr (std::is_floating_point<T>::value) {
+          number (static_cast<double> (_Value));
+        } else if constexpr (std::is_signed<T>::value) {
+          number (static_cast<int32_t> (_Value));
+        } else {
+          number (static_cast<uint32_t> (_Value));
+        }
+      };
+
+      /**
+       * @brief Write a Key-Value-Pair inside an Object
+       */
+      template <typename T>
+      void member (const char *_Key, T _Value) {
+        key (_Key);
+        value (_Value);
+      };
+      void member (const char *_Key, const String &_Value) {
+        key (_Key);
+        value (_Value);
+      };
+
+      void flush ();
+      size_t getWritten () const { return Written + Used; }; ///< Bytes written so far
+    };
+  }
+}
+
+#endif
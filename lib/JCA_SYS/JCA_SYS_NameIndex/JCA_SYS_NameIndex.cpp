@@ -0,0 +1,128 @@
+/**
+ * @file JCA_SYS_NameIndex.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Hash-Index to find the position of a Name inside a Vector without String compares
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_NameIndex.h>
+
+namespace JCA {
+  namespace SYS {
+    NameIndex::NameIndex () {
+      Mask = 0;
+      Count = 0;
+    }
+
+    /**
+     * @brief FNV-1a Hash of a zero terminated Name
+     *
+     * @param _Name Name to hash
+     * @return uint32_t Hash-Value
+     */
+    uint32_t NameIndex::hash (const char *_Name) {
+      uint32_t Hash = 2166136261UL;
+      while (*_Name) {
+        Hash ^= (uint8_t)(*_Name++);
+        Hash *= 16777619UL;
+      }
+      return Hash;
+    }
+
+    /**
+     * @brief FNV-1a Hash of a Buffer, can be continued to hash Data piece by piece
+     *
+     * @param _Data Buffer to hash
+     * @param _Length Length of the Buffer
+     * @param _Hash Result of the previous piece, or the default start value
+     * @return uint32_t Hash-Value
+     */
+    uint32_t NameIndex::hash (const uint8_t *_Data, size_t _Length, uint32_t _Hash) {
+      for (size_t i = 0; i < _Length; i++) {
+        _Hash ^= _Data[i];
+        _Hash *= 16777619UL;
+      }
+      return _Hash;
+    }
+
+    /**
+     * @brief Remove all Entries and free the Table
+     */
+    void NameIndex::clear () {
+      Slots.clear ();
+      Slots.shrink_to_fit ();
+      Mask = 0;
+      Count = 0;
+    }
+
+    /**
+     * @brief Clear the Index and create an empty Table for the expected Amount of Names.
+     * The Table is at least twice as big as the Count, so the probe chains stay short.
+     *
+     * @param _Count Amount of Names that will be added
+     */
+    void NameIndex::reserve (uint16_t _Count) {
+      uint16_t Size = 4;
+      while (Size < _Count * 2) {
+        Size <<= 1;
+      }
+      Slots.assign (Size, { 0, nullptr, -1 });
+      Slots.shrink_to_fit ();
+      Mask = Size - 1;
+      Count = 0;
+    }
+
+    /**
+     * @brief Add a Name to the Index, if the Name already exists the first Entry is kept
+     *
+     * @param _Name Name to add, the Pointer must stay valid
+     * @param _Index Position of the Name
+     * @return true Name added
+     * @return false Name already exists or the Table is full
+     */
+    bool NameIndex::add (const char *_Name, int16_t _Index) {
+      if (Slots.size () == 0 || Count >= Mask) {
+        return false;
+      }
+      uint32_t Hash = hash (_Name);
+      uint16_t Pos = Hash & Mask;
+      while (Slots[Pos].Name != nullptr) {
+        if (Slots[Pos].Hash == Hash && strcmp (Slots[Pos].Name, _Name) == 0) {
+          // Count duplicates too, so the Count is the Amount of added Names
+          Count++;
+          return false;
+        }
+        Pos = (Pos + 1) & Mask;
+      }
+      Slots[Pos] = { Hash, _Name, _Index };
+      Count++;
+      return true;
+    }
+
+    /**
+     * @brief Get the Position of a Name
+     *
+     * @param _Name Name to search
+     * @return int16_t Position of the Name or -1 if not found
+     */
+    int16_t NameIndex::find (const char *_Name) const {
+      if (Slots.size () == 0) {
+        return -1;
+      }
+      uint32_t Hash = hash (_Name);
+      uint16_t Pos = Hash & Mask;
+      while (Slots[Pos].Name != nullptr) {
+        if (Slots[Pos].Hash == Hash && strcmp (Slots[Pos].Name, _Name) == 0) {
+          return Slots[Pos].Index;
+        }
+        Pos = (Pos + 1) & Mask;
+      }
+      return -1;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file JCA_SYS_NameIndex.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Hash-Index to find the position of a Name inside a Vector without String compares
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_NAMEINDEX_
+#define _JCA_SYS_NAMEINDEX_
+
+#include <Arduino.h>
+#include <vector>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Open addressing Hash-Table (FNV-1a, linear probing), filled once after Setup.
+     * The Table stores only the Name-Pointers, so the Names must live as long as the Index.
+     */
+    class NameIndex {
+    private:
+      struct Slot_T {
+        uint32_t Hash;
+        const char *Name;
+        int16_t Index;
+      };
+      std::vector<Slot_T> Slots;
+      uint16_t Mask;
+      uint16_t Count;
+
+    public:
+      NameIndex ();
+      static uint32_t hash (const char *_Name);
+      static uint32_t hash (const uint8_t *_Data, size_t _Length, uint32_t _Hash = 2166136261UL);
+      void clear ();
+      void reserve (uint16_t _Count);
+      bool add (const char *_Name, int16_t _Index);
+      int16_t find (const char *_Name) const;
+      uint16_t getCount () const { return Count; }; ///< Amount of added Names, duplicates included
+    };
+  }
+}
+
+#endif
\ No newline at end of file
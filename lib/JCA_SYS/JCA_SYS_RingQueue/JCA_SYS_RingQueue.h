@@ -0,0 +1,112 @@
+/**
+ * @file JCA_SYS_RingQueue.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Bounded lock-free Queue for several Producers and one Consumer
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_RINGQUEUE_
+#define _JCA_SYS_RINGQUEUE_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Ring with a Sequence per Cell (D. Vyukov). Producers reserve a Cell by a Compare-and-Swap of the Head,
+     * the Consumer owns the Tail. A Cell is readable when its Sequence is one ahead of its Position.
+     * push never waits for the Consumer and pop never waits for a Producer, so both can be called from any Task.
+     *
+     * @tparam T Element, copied into the Cell
+     * @tparam Size Number of Cells, a Power of 2
+     */
+    template <typename T, size_t Size>
+    class RingQueue {
+      static_assert (Size >= 2 && (Size & (Size - 1)) == 0, "Size must be a Power of 2");
+
+    private:
+      struct Cell_T {
+        std::atomic<uint32_t> Sequence;
+        T Data;
+      };
+      Cell_T Cells[Size];
+      std::atomic<uint32_t> Head; ///< next Position to write
+      uint32_t Tail;              ///< next Position to read, only used by the Consumer
+      std::atomic<uint32_t> Dropped;
+
+    public:
+      RingQueue () : Head (0), Tail (0), Dropped (0) {
+        for (size_t i = 0; i < Size; i++) {
+          Cells[i].Sequence.store (i, std::memory_order_relaxed);
+        }
+      }
+      RingQueue (const RingQueue &) = delete;
+      RingQueue &operator= (const RingQueue &) = delete;
+
+      /**
+       * @brief Add an Element, may be called by several Producers at the same Time
+       *
+       * @param _Data Element
+       * @return true Element queued
+       * @return false Queue is full, the Element is counted as dropped
+       */
+      bool push (const T &_Data) {
+        uint32_t Pos = Head.load (std::memory_order_relaxed);
+        for (;;) {
+          Cell_T &Cell = Cells[Pos & (Size - 1)];
+          int32_t Diff = (int32_t)(Cell.Sequence.load (std::memory_order_acquire) - Pos);
+          if (Diff == 0) {
+            if (Head.compare_exchange_weak (Pos, Pos + 1, std::memory_order_relaxed)) {
+              Cell.Data = _Data;
+              Cell.Sequence.store (Pos + 1, std::memory_order_release);
+              return true;
+            }
+          } else if (Diff < 0) {
+            Dropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+          } else {
+            Pos = Head.load (std::memory_order_relaxed);
+          }
+        }
+      }
+
+      /**
+       * @brief Take the oldest Element, only one Consumer is allowed
+       *
+       * @param _Data Target
+       * @return true Element taken
+       * @return false Queue is empty, or the oldest Element is still written by its Producer
+       */
+      bool pop (T &_Data) {
+        Cell_T &Cell = Cells[Tail & (Size - 1)];
+        if ((int32_t)(Cell.Sequence.load (std::memory_order_acquire) - (Tail + 1)) < 0) {
+          return false;
+        }
+        _Data = Cell.Data;
+        Cell.Sequence.store (Tail + Size, std::memory_order_release);
+        Tail++;
+        return true;
+      }
+
+      /**
+       * @brief Number of Elements rejected because the Queue was full
+       */
+      uint32_t getDropped () {
+        return Dropped.load (std::memory_order_relaxed);
+      }
+
+      static constexpr size_t capacity () {
+        return Size;
+      }
+    };
+  }
+}
+
+#endif
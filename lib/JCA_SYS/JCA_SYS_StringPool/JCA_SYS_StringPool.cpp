@@ -0,0 +1,48 @@
+/**
+ * @file JCA_SYS_StringPool.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Pool of unique Texts for the Tag-Metadata that is generated at runtime
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_NameIndex.h>
+#include <JCA_SYS_StringPool.h>
+
+namespace JCA {
+  namespace SYS {
+    std::vector<StringPool::Entry_T> StringPool::Entries;
+    size_t StringPool::Bytes = 0;
+
+    /**
+     * @brief Get the stored Copy of a Text, a new Copy is only created for unknown Texts
+     *
+     * @param _Text Text to store
+     * @return const char* Pointer to the stored Text, "" if _Text is nullptr or the Heap is full
+     */
+    const char *StringPool::intern (const char *_Text) {
+      if (_Text == nullptr || _Text[0] == '\0') {
+        return "";
+      }
+      uint32_t Hash = NameIndex::hash (_Text);
+      for (const Entry_T &Entry : Entries) {
+        if (Entry.Hash == Hash && strcmp (Entry.Text, _Text) == 0) {
+          return Entry.Text;
+        }
+      }
+      size_t Length = strlen (_Text) + 1;
+      char *Text = static_cast<char *> (malloc (Length));
+      if (Text == nullptr) {
+        return "";
+      }
+      memcpy (Text, _Text, Length);
+      Entries.push_back ({ Hash, Text });
+      Bytes += Length;
+      return Text;
+    }
+  }
+}
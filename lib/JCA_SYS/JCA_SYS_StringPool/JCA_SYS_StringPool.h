@@ -0,0 +1,44 @@
+/**
+ * @file JCA_SYS_StringPool.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Pool of unique Texts for the Tag-Metadata that is generated at runtime
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_STRINGPOOL_
+#define _JCA_SYS_STRINGPOOL_
+
+#include <Arduino.h>
+#include <vector>
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Every Text is stored only once and never freed, so the returned Pointer stays valid
+     * for the whole Runtime and a Reinit with the same Setup does not allocate again.
+     * Not thread safe, only use it from the Setup.
+     */
+    class StringPool {
+    private:
+      struct Entry_T {
+        uint32_t Hash;
+        const char *Text;
+      };
+      static std::vector<Entry_T> Entries;
+      static size_t Bytes;
+
+    public:
+      static const char *intern (const char *_Text);
+      static const char *intern (const String &_Text) { return intern (_Text.c_str ()); };
+      static size_t getCount () { return Entries.size (); }; ///< Amount of unique Texts
+      static size_t getBytes () { return Bytes; };           ///< Heap used by the Texts
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * @file JCA_SYS_Task.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Periodic Task and Mutex, FreeRTOS on ESP32 and std::thread on a Host (Linux)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Task.h>
+
+#if defined(JCA_SYS_TASK_FREERTOS)
+  #include <esp_timer.h>
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+  #include <chrono>
+#endif
+
+namespace JCA {
+  namespace SYS {
+    //-------------------------------------------------------
+    // Mutex
+    //-------------------------------------------------------
+#if defined(JCA_SYS_TASK_FREERTOS)
+    Mutex::Mutex () {
+      Handle = xSemaphoreCreateMutex ();
+    }
+    Mutex::~Mutex () {
+      vSemaphoreDelete (Handle);
+    }
+    void Mutex::lock () {
+      xSemaphoreTake (Handle, portMAX_DELAY);
+    }
+    void Mutex::unlock () {
+      xSemaphoreGive (Handle);
+    }
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+    Mutex::Mutex () {
+    }
+    Mutex::~Mutex () {
+    }
+    void Mutex::lock () {
+      Handle.lock ();
+    }
+    void Mutex::unlock () {
+      Handle.unlock ();
+    }
+#else
+    Mutex::Mutex () {
+    }
+    Mutex::~Mutex () {
+    }
+    void Mutex::lock () {
+    }
+    void Mutex::unlock () {
+    }
+#endif
+
+    //-------------------------------------------------------
+    // Task
+    //-------------------------------------------------------
+    Task::Task () {
+      Period = 0;
+      Cycles = 0;
+      Overruns = 0;
+      MaxDuration = 0;
+#if defined(JCA_SYS_TASK_FREERTOS)
+      Handle = nullptr;
+      Running = false;
+      Stopped = true;
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+      Running = false;
+#endif
+    }
+
+    Task::~Task () {
+      stop ();
+    }
+
+    /**
+     * @brief Update the Statistic after a Cycle
+     *
+     * @param _Duration Duration of the Cycle in [us]
+     */
+    void Task::measure (uint32_t _Duration) {
+      Cycles++;
+      if (_Duration > MaxDuration) {
+        MaxDuration = _Duration;
+      }
+      if (_Duration > Period * 1000UL) {
+        Overruns++;
+      }
+    }
+
+    /**
+     * @brief Start the Thread, does nothing if it is already running
+     *
+     * @param _Name Name of the Task (Debugging only)
+     * @param _Period Period of the Cycle in [ms]
+     * @param _Cycle Function called every Period
+     * @param _Core CPU-Core to pin the Task to (ESP32 only)
+     * @param _Priority Priority of the Task (ESP32 only)
+     * @param _StackSize Stack-Size in Bytes (ESP32 only)
+     * @return true Task is running
+     * @return false no Backend available or the Task could not be created
+     */
+    bool Task::start (const char *_Name, uint32_t _Period, Callback _Cycle, uint8_t _Core, uint8_t _Priority, uint32_t _StackSize) {
+      if (isRunning ()) {
+        return true;
+      }
+      if (_Period == 0 || !_Cycle) {
+        return false;
+      }
+      Cycle = _Cycle;
+      Period = _Period;
+      Cycles = 0;
+      Overruns = 0;
+      MaxDuration = 0;
+#if defined(JCA_SYS_TASK_FREERTOS)
+      Running = true;
+      Stopped = false;
+      if (xTaskCreatePinnedToCore (entry, _Name, _StackSize, this, _Priority, &Handle, _Core) != pdPASS) {
+        Handle = nullptr;
+        Running = false;
+        Stopped = true;
+        return false;
+      }
+      return true;
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+      Running = true;
+      Handle = std::thread (&Task::run, this);
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    /**
+     * @brief Stop the Thread and wait until the current Cycle is finished
+     */
+    void Task::stop () {
+#if defined(JCA_SYS_TASK_FREERTOS)
+      if (Handle == nullptr) {
+        return;
+      }
+      Running = false;
+      while (!Stopped) {
+        vTaskDelay (1);
+      }
+      Handle = nullptr;
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+      Running = false;
+      if (Handle.joinable ()) {
+        Handle.join ();
+      }
+#endif
+    }
+
+    bool Task::isRunning () const {
+#if defined(JCA_SYS_TASK_FREERTOS) || defined(JCA_SYS_TASK_STDTHREAD)
+      return Running;
+#else
+      return false;
+#endif
+    }
+
+#if defined(JCA_SYS_TASK_FREERTOS)
+    void Task::entry (void *_Task) {
+      static_cast<Task *> (_Task)->run ();
+      static_cast<Task *> (_Task)->Stopped = true;
+      vTaskDelete (nullptr);
+    }
+
+    void Task::run () {
+      TickType_t Wake = xTaskGetTickCount ();
+      TickType_t Ticks = pdMS_TO_TICKS (Period);
+      if (Ticks == 0) {
+        Ticks = 1;
+      }
+      while (Running) {
+        int64_t Start = esp_timer_get_time ();
+        Cycle ();
+        measure ((uint32_t)(esp_timer_get_time () - Start));
+        // Restart the Timing after an Overrun, instead of catching up with several Cycles.
+        // Block at least one Tick, a Yield never lets Tasks with a lower Priority (loopTask) run
+        if ((TickType_t)(xTaskGetTickCount () - Wake) >= Ticks) {
+          vTaskDelay (1);
+          Wake = xTaskGetTickCount ();
+        } else {
+          vTaskDelayUntil (&Wake, Ticks);
+        }
+      }
+    }
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+    void Task::run () {
+      std::chrono::steady_clock::time_point Wake = std::chrono::steady_clock::now ();
+      std::chrono::milliseconds Step (Period);
+      while (Running) {
+        std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now ();
+        Cycle ();
+        std::chrono::steady_clock::time_point End = std::chrono::steady_clock::now ();
+        measure ((uint32_t)std::chrono::duration_cast<std::chrono::microseconds> (End - Start).count ());
+        // Restart the Timing after an Overrun, instead of catching up with several Cycles
+        Wake += Step;
+        if (Wake <= End) {
+          Wake = End;
+        } else {
+          std::this_thread::sleep_until (Wake);
+        }
+      }
+    }
+#else
+    void Task::run () {
+    }
+#endif
+  }
+}
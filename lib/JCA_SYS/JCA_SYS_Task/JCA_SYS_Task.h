@@ -0,0 +1,112 @@
+/**
+ * @file JCA_SYS_Task.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Periodic Task and Mutex, FreeRTOS on ESP32 and std::thread on a Host (Linux)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_SYS_TASK_
+#define _JCA_SYS_TASK_
+
+#include <functional>
+#include <stdint.h>
+
+// Select the Backend, ESP8266 has no Threads and runs everything inside loop()
+#if defined(ESP32)
+  #define JCA_SYS_TASK_FREERTOS
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/semphr.h>
+  #include <freertos/task.h>
+#elif defined(ESP8266)
+  #define JCA_SYS_TASK_NONE
+#else
+  #define JCA_SYS_TASK_STDTHREAD
+  #include <atomic>
+  #include <mutex>
+  #include <thread>
+#endif
+
+namespace JCA {
+  namespace SYS {
+    /**
+     * @brief Non recursive Mutex, without Backend it does nothing
+     */
+    class Mutex {
+    private:
+#if defined(JCA_SYS_TASK_FREERTOS)
+      SemaphoreHandle_t Handle;
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+      std::mutex Handle;
+#endif
+
+    public:
+      Mutex ();
+      ~Mutex ();
+      Mutex (const Mutex &) = delete;
+      Mutex &operator= (const Mutex &) = delete;
+      void lock ();
+      void unlock ();
+    };
+
+    /**
+     * @brief Hold a Mutex until the end of the Scope
+     */
+    class MutexLock {
+    private:
+      Mutex &Lock;
+
+    public:
+      MutexLock (Mutex &_Lock) : Lock (_Lock) { Lock.lock (); };
+      ~MutexLock () { Lock.unlock (); };
+      MutexLock (const MutexLock &) = delete;
+      MutexLock &operator= (const MutexLock &) = delete;
+    };
+
+    /**
+     * @brief Calls a Function with a fixed Period inside an own Thread.
+     * A Cycle that takes longer than the Period is counted as Overrun, the next Cycle starts immediately.
+     */
+    class Task {
+    public:
+      typedef std::function<void ()> Callback;
+
+    private:
+      Callback Cycle;
+      uint32_t Period;
+      uint32_t Cycles;
+      uint32_t Overruns;
+      uint32_t MaxDuration;
+#if defined(JCA_SYS_TASK_FREERTOS)
+      TaskHandle_t Handle;
+      volatile bool Running;
+      volatile bool Stopped;
+      static void entry (void *_Task);
+#elif defined(JCA_SYS_TASK_STDTHREAD)
+      std::thread Handle;
+      std::atomic<bool> Running;
+#endif
+      void run ();
+      void measure (uint32_t _Duration);
+
+    public:
+      Task ();
+      ~Task ();
+      Task (const Task &) = delete;
+      Task &operator= (const Task &) = delete;
+      bool start (const char *_Name, uint32_t _Period, Callback _Cycle, uint8_t _Core = 1, uint8_t _Priority = 2, uint32_t _StackSize = 8192);
+      void stop ();
+      bool isRunning () const;
+      uint32_t getPeriod () const { return Period; };         ///< Period in [ms]
+      uint32_t getCycles () const { return Cycles; };         ///< Amount of executed Cycles
+      uint32_t getOverruns () const { return Overruns; };     ///< Cycles longer than the Period
+      uint32_t getMaxDuration () const { return MaxDuration; }; ///< Longest Cycle in [us]
+    };
+  }
+}
+
+#endif
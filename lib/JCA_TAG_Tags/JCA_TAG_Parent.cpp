@@ -10,13 +10,17 @@
  *
  */
 
+#include <JCA_SYS_NameIndex.h>
 #include <JCA_TAG_Parent.h>
+#include <limits>
+#include <type_traits>
 using namespace JCA::SYS;
 
 namespace JCA {
   namespace TAG {
-    TagParent::TagParent (String _Name, String _Text, String _Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage, SetCallback _CB) {
+    TagParent::TagParent (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage, SetCallback _CB) {
       Type = _Type;
+      ValueType = _Type;
       Usage = _Usage;
       Name = _Name;
       Text = _Text;
@@ -24,33 +28,179 @@ namespace JCA {
       ReadOnly = _ReadOnly;
       Value = _Value;
       afterSetCB = _CB;
+      Version = 0;
+      Shadow = 0;
     }
 
-    TagParent::TagParent (String _Name, String _Text, String _Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage) {
+    TagParent::TagParent (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage) {
       Type = _Type;
+      ValueType = _Type;
       Usage = _Usage;
       Name = _Name;
       Text = _Text;
       Comment = _Comment;
       ReadOnly = _ReadOnly;
       Value = _Value;
+      Version = 0;
+      Shadow = 0;
     }
 
     /**
-     * @brief Create a basic TagParent-Config-String with al default informations
-     * 
-     * @return String JsonString with default informations
+     * @brief Write the default Informations of the Tag into the opened Json-Object
+     *
+     * @param _Writer Writer with an opened Object
      */
-    String TagParent::writeTagBase () {
-      String SetupTag;
-      SetupTag += "\"" + String (JCA_TAG_TAGS_JsonName) + "\":\"" + Name + "\"";
-      SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonText) + "\":\"" + Text + "\"";
-      SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonType) + "\":" + String(Type);
-      SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonReadOnly) + "\":" + String(ReadOnly);
-      if (Comment.length() > 0) {
-        SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonComment) + "\":\"" + String (Comment) + "\"";
+    void TagParent::writeTagBase (JsonWriter &_Writer) {
+      _Writer.member (JCA_TAG_TAGS_JsonName, Name);
+      _Writer.member (JCA_TAG_TAGS_JsonText, Text);
+      _Writer.member (JCA_TAG_TAGS_JsonType, static_cast<uint8_t> (Type));
+      _Writer.member (JCA_TAG_TAGS_JsonReadOnly, static_cast<uint8_t> (ReadOnly));
+      if (Comment[0] != '\0') {
+        _Writer.member (JCA_TAG_TAGS_JsonComment, Comment);
+      }
+    }
+  
+    /**
+     * @brief Compare the Value with the Shadow of the last Version and move the Version if it was changed.
+     * Catches writes of the Function directly to the Value, without using the Tag.
+     * Arrays are not compared, their Version only moves on setValue.
+     *
+     * @return true Value was changed since the last call
+     * @return false Value unchanged
+     */
+    bool TagParent::updateVersion () {
+      uint32_t Raw = 0;
+      switch (ValueType) {
+      case TagTypes_T::TypeBool:
+      case TagTypes_T::TypeUInt8:
+        Raw = *static_cast<uint8_t *> (Value);
+        break;
+      case TagTypes_T::TypeInt16:
+      case TagTypes_T::TypeUInt16:
+        Raw = *static_cast<uint16_t *> (Value);
+        break;
+      case TagTypes_T::TypeInt32:
+      case TagTypes_T::TypeUInt32:
+      case TagTypes_T::TypeFloat:
+        memcpy (&Raw, Value, sizeof (Raw));
+        break;
+      case TagTypes_T::TypeString:
+        Raw = JCA::SYS::NameIndex::hash (static_cast<String *> (Value)->c_str ());
+        break;
+      default:
+        return false;
+      }
+      if (Raw == Shadow) {
+        return false;
+      }
+      Shadow = Raw;
+      Version++;
+      return true;
+    }
+
+    /**
+     * @brief Convert a Value from Source- to Target-Datatype.
+     * Values outside the Range of an Integer-Target are limited to it, NaN becomes 0 (or false).
+     * Unlike the Json-Conversion before (0 for every Value out of Range), a Link keeps the nearest Value.
+     *
+     * @tparam S Datatype of the Source
+     * @tparam T Datatype of the Target
+     * @param _Source Pointer to the Source-Value
+     * @param _Target Pointer to the Target-Value
+     */
+    template <typename S, typename T>
+    static void copyTagValue (void *_Source, void *_Target) {
+      S Source = *static_cast<S *> (_Source);
+      T &Target = *static_cast<T *> (_Target);
+      if constexpr (std::is_floating_point<S>::value && std::is_integral<T>::value) {
+        if (Source != Source) {
+          Target = 0;
+          return;
+        }
+      }
+      if constexpr (std::is_integral<T>::value && !std::is_same<T, bool>::value) {
+        if constexpr (std::is_floating_point<S>::value) {
+          if (Source <= static_cast<S> (std::numeric_limits<T>::min ())) {
+            Target = std::numeric_limits<T>::min ();
+            return;
+          }
+          if (Source >= static_cast<S> (std::numeric_limits<T>::max ())) {
+            Target = std::numeric_limits<T>::max ();
+            return;
+          }
+        } else if constexpr (!std::is_same<S, bool>::value) {
+          // All Tag-Integers have up to 32 Bit, so 64 Bit holds both Ranges exactly
+          int64_t Wide = static_cast<int64_t> (Source);
+          if (Wide < static_cast<int64_t> (std::numeric_limits<T>::min ())) {
+            Target = std::numeric_limits<T>::min ();
+            return;
+          }
+          if (Wide > static_cast<int64_t> (std::numeric_limits<T>::max ())) {
+            Target = std::numeric_limits<T>::max ();
+            return;
+          }
+        }
+      }
+      Target = static_cast<T> (Source);
+    }
+
+    static void copyTagString (void *_Source, void *_Target) {
+      *static_cast<String *> (_Target) = *static_cast<String *> (_Source);
+    }
+
+    template <typename S>
+    static TagCopyFunction getTagCopyFunctionTo (TagTypes_T _TargetType) {
+      switch (_TargetType) {
+      case TagTypes_T::TypeBool:
+        return copyTagValue<S, bool>;
+      case TagTypes_T::TypeFloat:
+        return copyTagValue<S, float>;
+      case TagTypes_T::TypeUInt8:
+        return copyTagValue<S, uint8_t>;
+      case TagTypes_T::TypeInt16:
+        return copyTagValue<S, int16_t>;
+      case TagTypes_T::TypeUInt16:
+        return copyTagValue<S, uint16_t>;
+      case TagTypes_T::TypeInt32:
+        return copyTagValue<S, int32_t>;
+      case TagTypes_T::TypeUInt32:
+        return copyTagValue<S, uint32_t>;
+      default:
+        return nullptr;
+      }
+    }
+
+    /**
+     * @brief Get a typed Copy-Function to move a Value between two Tags without using JSON
+     *
+     * @param _SourceType ValueType of the Source-Tag
+     * @param _TargetType ValueType of the Target-Tag
+     * @return TagCopyFunction Conversion Function or nullptr if the Types could not be converted
+     */
+    TagCopyFunction getTagCopyFunction (TagTypes_T _SourceType, TagTypes_T _TargetType) {
+      switch (_SourceType) {
+      case TagTypes_T::TypeBool:
+        return getTagCopyFunctionTo<bool> (_TargetType);
+      case TagTypes_T::TypeFloat:
+        return getTagCopyFunctionTo<float> (_TargetType);
+      case TagTypes_T::TypeUInt8:
+        return getTagCopyFunctionTo<uint8_t> (_TargetType);
+      case TagTypes_T::TypeInt16:
+        return getTagCopyFunctionTo<int16_t> (_TargetType);
+      case TagTypes_T::TypeUInt16:
+        return getTagCopyFunctionTo<uint16_t> (_TargetType);
+      case TagTypes_T::TypeInt32:
+        return getTagCopyFunctionTo<int32_t> (_TargetType);
+      case TagTypes_T::TypeUInt32:
+        return getTagCopyFunctionTo<uint32_t> (_TargetType);
+      case TagTypes_T::TypeString:
+        if (_TargetType == TagTypes_T::TypeString) {
+          return copyTagString;
+        }
+        return nullptr;
+      default:
+        return nullptr;
       }
-      return SetupTag;
     }
   }
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
  * @file JCA_TAG_TAGs.h
  * @author JCA (https://github.com/ichok)
  * @brief Collection of Tag-Classes to create an Element
- * @version 1.0
+ * @version 1.1
  * @date 2024-04-07
+ * @changelog
+ * - [1.1] 2026-10-17: Write the Tag-Setup through a JsonWriter instead of building Strings
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -16,6 +18,9 @@
 #include "FS.h"
 #include <ArduinoJson.h>
 
+#include <JCA_SYS_Arena.h>
+#include <JCA_SYS_JsonWriter.h>
+#include <JCA_SYS_StringPool.h>
 #include <JCA_SYS_DebugOut.h>
 #include <JCA_SYS_Conversion.h>
 
@@ -65,28 +70,45 @@ namespace JCA {
     };
 
     typedef std::function<void (void)> SetCallback;
+    typedef void (*TagCopyFunction) (void *_Source, void *_Target);
+
+    TagCopyFunction getTagCopyFunction (TagTypes_T _SourceType, TagTypes_T _TargetType);
+
     class TagParent {
       protected:
         SetCallback afterSetCB;
-        String writeTagBase ();
+        uint32_t Shadow; ///< Raw-Value (or Hash) of the last Version, to detect direct writes of the Function
+        void writeTagBase (JCA::SYS::JsonWriter &_Writer);
 
       public:
         // Default Informations
         TagTypes_T Type;
+        TagTypes_T ValueType; ///< Datatype behind the Value-Pointer, Type could be overwritten by web styles
         TagUsage_T Usage;
-        String Name;
-        String Text;
-        String Comment;
+        // Texts are only referenced, use Literals or JCA::SYS::StringPool for generated ones
+        const char *Name;
+        const char *Text;
+        const char *Comment;
         bool ReadOnly;
         void* Value;
+        uint32_t Version; ///< Modification counter, moves on every change of the Value
 
-        TagParent (String _Name, String _Text, String _Comment, bool _ReadOnly, void* _Value, TagTypes_T _Type, TagUsage_T _Usage, SetCallback _CB);
-        TagParent (String _Name, String _Text, String _Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage);
+        TagParent (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, void* _Value, TagTypes_T _Type, TagUsage_T _Usage, SetCallback _CB);
+        TagParent (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, void *_Value, TagTypes_T _Type, TagUsage_T _Usage);
         virtual ~TagParent() {;};
-        virtual String writeTag () { return ""; };
+        // Tags live as long as the Setup, keep them together inside the Arena
+        static void *operator new (size_t _Size) { return JCA::SYS::Arena::Objects.allocate (_Size); };
+        static void operator delete (void *_Ptr) { JCA::SYS::Arena::release (_Ptr); };
+        virtual void writeTag (JCA::SYS::JsonWriter &_Writer) { writeTagBase (_Writer); };
         virtual bool getValue (JsonVariant _Value) { return false; };
         virtual bool setValue(JsonVariant _Value) {return false; };
         virtual void addValue (JsonObject &_Values) {; };
+        bool updateVersion ();
+        void afterSet () {
+          if (afterSetCB) {
+            afterSetCB ();
+          }
+        };
     };
   }
 }
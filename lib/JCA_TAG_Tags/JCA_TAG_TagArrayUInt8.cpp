@@ -27,24 +27,25 @@ namespace JCA {
      * @param _Length Length of the Value-Array
      * @param _CB Optional Callback-Function, if defined it will execute after setting the new Value
      */
-    TagArrayUInt8::TagArrayUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length, SetCallback _CB)
+    TagArrayUInt8::TagArrayUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length, SetCallback _CB)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, TagTypes_T::TypeArrayUInt8, _Usage, _CB) {
+      ValueType = TagTypes_T::TypeArrayUInt8;
       Length = _Length;
     }
 
-    TagArrayUInt8::TagArrayUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length)
+    TagArrayUInt8::TagArrayUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, TagTypes_T::TypeArrayUInt8, _Usage) {
+      ValueType = TagTypes_T::TypeArrayUInt8;
       Length = _Length;
     }
 
     /**
-     * @brief Create the config Json-String of the Tag-Data
+     * @brief Write the config Tag-Data into the opened Json-Object
      *
-     * @return String Json-String
+     * @param _Writer Writer with an opened Object
      */
-    String TagArrayUInt8::writeTag () {
-      String SetupTag = writeTagBase ();
-      return SetupTag;
+    void TagArrayUInt8::writeTag (JsonWriter &_Writer) {
+      writeTagBase (_Writer);
     }
 
     /**
@@ -79,6 +80,9 @@ namespace JCA {
       } else if (_Value.is<const char *> ()) {
         RetValue = JCA::SYS::HexStringToByteArray (_Value.as<String> (), static_cast<uint8_t *> (Value), Length);
       }
+      if (RetValue) {
+        Version++;
+      }
       if (afterSetCB && RetValue) {
         afterSetCB ();
       }
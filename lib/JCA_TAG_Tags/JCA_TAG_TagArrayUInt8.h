@@ -2,8 +2,10 @@
  * @file JCA_TAG_TAGArrayUInt8.h
  * @author JCA (https://github.com/ichok)
  * @brief Collection of Tag-Classes to create an Element
- * @version 1.0
+ * @version 1.1
  * @date 2024-04-14
+ * @changelog
+ * - [1.1] 2026-10-17: Write the Setup through the JsonWriter
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -22,10 +24,10 @@ namespace JCA {
         // Type Informations
         uint8_t Length;
         
-        TagArrayUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length, SetCallback _CB);
-        TagArrayUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length);
+        TagArrayUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length, SetCallback _CB);
+        TagArrayUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, uint8_t _Length);
         ~TagArrayUInt8() {;};
-        String writeTag ();
+        void writeTag (JCA::SYS::JsonWriter &_Writer);
         bool getValue (JsonVariant _Value);
         bool setValue(JsonVariant _Value);
         void addValue (JsonObject &_Values);
@@ -28,28 +28,29 @@ namespace JCA {
      * @param _BtnOffText Button-Text ift the tag is false
      * @param _CB Optional Callback-Function, if defined it will execute after setting the new Value
      */
-    TagBool::TagBool (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, bool *_Value, String _BtnOnText, String _BtnOffText, SetCallback _CB, TagTypes_T _Type)
+    TagBool::TagBool (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, bool *_Value, const char *_BtnOnText, const char *_BtnOffText, SetCallback _CB, TagTypes_T _Type)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage, _CB) {
+      ValueType = TagTypes_T::TypeBool;
       BtnOnText = _BtnOnText;
       BtnOffText = _BtnOffText;
     }
 
-    TagBool::TagBool (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, bool *_Value, String _BtnOnText, String _BtnOffText, TagTypes_T _Type)
+    TagBool::TagBool (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, bool *_Value, const char *_BtnOnText, const char *_BtnOffText, TagTypes_T _Type)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage) {
+      ValueType = TagTypes_T::TypeBool;
       BtnOnText = _BtnOnText;
       BtnOffText = _BtnOffText;
     }
 
     /**
-     * @brief Create the complete Json-String of the Tag-Data
+     * @brief Write the complete Tag-Data into the opened Json-Object
      *
-     * @return String inner Json-String, without {...}
+     * @param _Writer Writer with an opened Object
      */
-    String TagBool::writeTag () {
-      String SetupTag = writeTagBase ();
-      SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonOn) + "\":\"" + BtnOnText + "\"";
-      SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonOff) + "\":\"" + BtnOffText + "\"";
-      return SetupTag;
+    void TagBool::writeTag (JsonWriter &_Writer) {
+      writeTagBase (_Writer);
+      _Writer.member (JCA_TAG_TAGS_JsonOn, BtnOnText);
+      _Writer.member (JCA_TAG_TAGS_JsonOff, BtnOffText);
     }
 
     /**
@@ -72,6 +73,7 @@ namespace JCA {
      */
     bool TagBool::setValue (JsonVariant _Value) {
       *(static_cast<bool *> (Value)) = _Value.as<bool> ();
+      updateVersion ();
       if (afterSetCB) {
         afterSetCB ();
       }
@@ -27,12 +27,14 @@ namespace JCA {
      * @param _Unit Unit of the Tag, showen on the website
      * @param _CB Optional Callback-Function, if defined it will execute after setting the new Value
      */
-    TagListUInt8::TagListUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, SetCallback _CB)
+    TagListUInt8::TagListUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, SetCallback _CB)
     : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, TagTypes_T::TypeListUInt8, _Usage, _CB) {
+      ValueType = TagTypes_T::TypeUInt8;
     }
 
-    TagListUInt8::TagListUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value)
+    TagListUInt8::TagListUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value)
     : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, TagTypes_T::TypeListUInt8, _Usage) {
+      ValueType = TagTypes_T::TypeUInt8;
     }
 
     TagListUInt8::~TagListUInt8() {
@@ -40,27 +42,27 @@ namespace JCA {
     }
 
     /**
-     * @brief Create the complete Json-String of the Tag-Data
+     * @brief Write the complete Tag-Data into the opened Json-Object
      *
-     * @return String Json-String
+     * @param _Writer Writer with an opened Object
      */
-    String TagListUInt8::writeTag () {
-      String SetupTag = writeTagBase ();
-      int16_t Counter = 0;
-      // for each Listmap
-      for (const auto &[Index, Text] : List) {
-        if (Counter == 0) {
-          SetupTag += ",\"" + String (JCA_TAG_TAGS_JsonList) + "\": [";
-          SetupTag += "{\"" + String (JCA_TAG_TAGS_JsonListIndex) + "\":\"" + String (Index) + "\",\"" + String (JCA_TAG_TAGS_JsonListValue) + "\":\"" + Text + "\"}";
-        } else {
-          SetupTag += ",{\"" + String (JCA_TAG_TAGS_JsonListIndex) + "\":\"" + String (Index) + "\",\"" + String (JCA_TAG_TAGS_JsonListValue) + "\":\"" + Text + "\"}";
-        }
-        Counter++;
+    void TagListUInt8::writeTag (JsonWriter &_Writer) {
+      writeTagBase (_Writer);
+      if (List.empty ()) {
+        return;
       }
-      if (Counter > 0) {
-        SetupTag += "]";
+      _Writer.key (JCA_TAG_TAGS_JsonList);
+      _Writer.beginArray ();
+      for (const auto &[Index, Text] : List) {
+        // The Index stays a Text, like the website expects it
+        char IndexText[4];
+        snprintf (IndexText, sizeof (IndexText), "%u", Index);
+        _Writer.beginObject ();
+        _Writer.member (JCA_TAG_TAGS_JsonListIndex, IndexText);
+        _Writer.member (JCA_TAG_TAGS_JsonListValue, Text);
+        _Writer.endObject ();
       }
-      return SetupTag;
+      _Writer.endArray ();
     }
 
     /**
@@ -95,6 +97,7 @@ namespace JCA {
         *(static_cast<uint8_t *> (Value)) = _Value.as<uint8_t> ();
         RetValue = true;
       }
+      updateVersion ();
       if (afterSetCB && RetValue) {
         afterSetCB ();
       }
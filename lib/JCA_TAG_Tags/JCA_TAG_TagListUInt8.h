@@ -2,8 +2,10 @@
  * @file JCA_TAG_TAGListUInt8.h
  * @author JCA (https://github.com/ichok)
  * @brief Collection of Tag-Classes to create an Element
- * @version 1.0
+ * @version 1.1
  * @date 2024-04-07
+ * @changelog
+ * - [1.1] 2026-10-17: Write the Setup through the JsonWriter
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -23,10 +25,10 @@ namespace JCA {
         // Type Informations
         std::map<uint8_t, String> List;
 
-        TagListUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, SetCallback _CB);
-        TagListUInt8 (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value);
+        TagListUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value, SetCallback _CB);
+        TagListUInt8 (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, uint8_t *_Value);
         ~TagListUInt8 ();
-        String writeTag ();
+        void writeTag (JCA::SYS::JsonWriter &_Writer);
         bool getValue (JsonVariant _Value);
         bool setValue (JsonVariant _Value);
         void addValue (JsonObject &_Values);
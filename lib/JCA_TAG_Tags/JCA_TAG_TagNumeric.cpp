@@ -0,0 +1,128 @@
+/**
+ * @file JCA_TAG_TagNumeric.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Numeric Tag for all Integer and Float Datatypes, replaces the single Tag-Classes
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_TAG_TagNumeric.h>
+using namespace JCA::SYS;
+
+namespace JCA {
+  namespace TAG {
+    /**
+     * @brief Construct a new TagNumeric object, without Range
+     *
+     * @param _Name Name of the Element (in JSON)
+     * @param _Text Text showen on the website
+     * @param _Comment Comment showen on the website if nedded
+     * @param _ReadOnly set the Tag to read only, can only write by the Function-Object
+     * @param _Usage Usage-Type to sort the Tag on teh website
+     * @param _Value Pointer to the Value-Datapoint inside the Function-Object
+     * @param _Unit Unit of the Tag, showen on the website
+     * @param _CB Optional Callback-Function, if defined it will execute after setting the new Value
+     * @param _Type Type for the website, to override with custom web styles
+     */
+    template <typename T>
+    TagNumeric<T>::TagNumeric (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, T *_Value, const char *_Unit, SetCallback _CB, TagTypes_T _Type)
+        : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage, _CB) {
+      ValueType = TagNumericType<T>::Value;
+      Unit = _Unit;
+      Min = std::numeric_limits<T>::lowest ();
+      Max = std::numeric_limits<T>::max ();
+    }
+
+    template <typename T>
+    TagNumeric<T>::TagNumeric (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, T *_Value, const char *_Unit, TagTypes_T _Type)
+        : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage) {
+      ValueType = TagNumericType<T>::Value;
+      Unit = _Unit;
+      Min = std::numeric_limits<T>::lowest ();
+      Max = std::numeric_limits<T>::max ();
+    }
+
+    /**
+     * @brief Limit all following Writes to a Range
+     *
+     * @param _Min lowest allowed Value
+     * @param _Max highest allowed Value
+     * @return TagNumeric<T>* the Tag itself, to use it directly inside Tags.push_back
+     */
+    template <typename T>
+    TagNumeric<T> *TagNumeric<T>::setRange (T _Min, T _Max) {
+      Min = _Min;
+      Max = _Max;
+      return this;
+    }
+
+    /**
+     * @brief Write the complete Tag-Data into the opened Json-Object
+     *
+     * @param _Writer Writer with an opened Object
+     */
+    template <typename T>
+    void TagNumeric<T>::writeTag (JsonWriter &_Writer) {
+      writeTagBase (_Writer);
+      _Writer.member (JCA_TAG_TAGS_JsonUnit, Unit);
+      if (hasRange ()) {
+        _Writer.member (JCA_TAG_TAGS_JsonMin, Min);
+        _Writer.member (JCA_TAG_TAGS_JsonMax, Max);
+      }
+    }
+
+    /**
+     * @brief Get the Value into an JsonVariant
+     *
+     * @param _Value Reference to the JsonVariant to which the value is to be written
+     * @return true Value was successfully written to _Value
+     * @return false something failed
+     */
+    template <typename T>
+    bool TagNumeric<T>::getValue (JsonVariant _Value) {
+      return _Value.set (get ());
+    }
+
+    /**
+     * @brief Set the value of the Tag, limited to the Range
+     *
+     * @param _Value Value that should be set
+     * @return true Tag-Value was successfully set
+     * @return false something failed
+     */
+    template <typename T>
+    bool TagNumeric<T>::setValue (JsonVariant _Value) {
+      if constexpr (std::is_integral<T>::value) {
+        // Integers are limited exactly, without the way over a Float
+        if (_Value.is<int32_t> ()) {
+          return set (_Value.as<int32_t> ());
+        }
+        if (_Value.is<uint32_t> ()) {
+          return set (_Value.as<uint32_t> ());
+        }
+      }
+      return set (_Value.as<float> ());
+    }
+
+    /**
+     * @brief Create a key-value-pair of the Tag inside an JsonObject
+     *
+     * @param _Values Reference to tha JsonObject
+     */
+    template <typename T>
+    void TagNumeric<T>::addValue (JsonObject &_Values) {
+      _Values[Name] = get ();
+    }
+
+    template class TagNumeric<uint8_t>;
+    template class TagNumeric<int16_t>;
+    template class TagNumeric<uint16_t>;
+    template class TagNumeric<int32_t>;
+    template class TagNumeric<uint32_t>;
+    template class TagNumeric<float>;
+  }
+}
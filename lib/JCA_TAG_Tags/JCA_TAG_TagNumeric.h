@@ -0,0 +1,142 @@
+/**
+ * @file JCA_TAG_TagNumeric.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Numeric Tag for all Integer and Float Datatypes, replaces the single Tag-Classes
+ * @version 1.1
+ * @date 2026-10-17
+ * @changelog
+ * - [1.1] 2026-10-17: Write min/max as Numbers through the JsonWriter
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_TAG_TAGNUMERIC_
+#define _JCA_TAG_TAGNUMERIC_
+
+#include <JCA_TAG_Parent.h>
+#include <limits>
+#include <math.h>
+#include <type_traits>
+
+#define JCA_TAG_TAGS_JsonMin "min"
+#define JCA_TAG_TAGS_JsonMax "max"
+
+namespace JCA {
+  namespace TAG {
+    /**
+     * @brief Tag-Type of a Datatype, only the specialized Datatypes can be used by TagNumeric
+     */
+    template <typename T>
+    struct TagNumericType;
+    template <>
+    struct TagNumericType<uint8_t> {
+      static const TagTypes_T Value = TypeUInt8;
+    };
+    template <>
+    struct TagNumericType<int16_t> {
+      static const TagTypes_T Value = TypeInt16;
+    };
+    template <>
+    struct TagNumericType<uint16_t> {
+      static const TagTypes_T Value = TypeUInt16;
+    };
+    template <>
+    struct TagNumericType<int32_t> {
+      static const TagTypes_T Value = TypeInt32;
+    };
+    template <>
+    struct TagNumericType<uint32_t> {
+      static const TagTypes_T Value = TypeUInt32;
+    };
+    template <>
+    struct TagNumericType<float> {
+      static const TagTypes_T Value = TypeFloat;
+    };
+
+    /**
+     * @brief Tag for a numeric Value with optional Range.
+     * Every Write (Json or typed) is limited to the Range, the typed get/set work without Json and virtual calls.
+     *
+     * @tparam T Datatype of the Value inside the Function-Object
+     */
+    template <typename T>
+    class TagNumeric : public TagParent {
+      static_assert (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "TagNumeric needs a numeric Datatype");
+
+      public:
+        // Type Informations
+        const char *Unit;
+        T Min;
+        T Max;
+
+        TagNumeric (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, T *_Value, const char *_Unit, SetCallback _CB, TagTypes_T _Type = TagNumericType<T>::Value);
+        TagNumeric (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, T *_Value, const char *_Unit, TagTypes_T _Type = TagNumericType<T>::Value);
+        ~TagNumeric () { ; };
+        TagNumeric<T> *setRange (T _Min, T _Max);
+        bool hasRange () const {
+          return Min != std::numeric_limits<T>::lowest () || Max != std::numeric_limits<T>::max ();
+        };
+        void writeTag (JCA::SYS::JsonWriter &_Writer);
+        bool getValue (JsonVariant _Value);
+        bool setValue (JsonVariant _Value);
+        void addValue (JsonObject &_Values);
+
+        /**
+         * @brief Read the Value without Json
+         *
+         * @tparam V Requested Datatype, default is the Datatype of the Tag
+         * @return V current Value
+         */
+        template <typename V = T>
+        V get () const {
+          return static_cast<V> (*static_cast<T *> (Value));
+        };
+
+        /**
+         * @brief Write the Value without Json, limited to the Range of the Tag
+         *
+         * @tparam V Datatype of the new Value
+         * @param _Value new Value
+         * @return true Value was set (maybe limited)
+         * @return false Value is not a Number
+         */
+        template <typename V>
+        bool set (V _Value) {
+          T New;
+          if constexpr (std::is_same<V, T>::value) {
+            if constexpr (std::is_floating_point<T>::value) {
+              if (isnan (_Value)) {
+                return false;
+              }
+            }
+            New = _Value < Min ? Min : (_Value > Max ? Max : _Value);
+          } else if constexpr (std::is_integral<V>::value && std::is_integral<T>::value) {
+            int64_t Wide = static_cast<int64_t> (_Value);
+            New = static_cast<T> (Wide < static_cast<int64_t> (Min) ? Min : (Wide > static_cast<int64_t> (Max) ? Max : Wide));
+          } else {
+            double Wide = static_cast<double> (_Value);
+            if (isnan (Wide)) {
+              return false;
+            }
+            New = static_cast<T> (Wide < static_cast<double> (Min) ? Min : (Wide > static_cast<double> (Max) ? Max : Wide));
+          }
+          *static_cast<T *> (Value) = New;
+          updateVersion ();
+          afterSet ();
+          return true;
+        };
+    };
+
+    // The Code exists only once inside JCA_TAG_TagNumeric.cpp
+    extern template class TagNumeric<uint8_t>;
+    extern template class TagNumeric<int16_t>;
+    extern template class TagNumeric<uint16_t>;
+    extern template class TagNumeric<int32_t>;
+    extern template class TagNumeric<uint32_t>;
+    extern template class TagNumeric<float>;
+  }
+}
+
+#endif
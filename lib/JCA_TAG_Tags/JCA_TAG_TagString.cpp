@@ -26,22 +26,23 @@ namespace JCA {
      * @param _Value Pointer to the Value-Datapoint inside the Function-Object
      * @param _CB Optional Callback-Function, if defined it will execute after setting the new Value
      */
-    TagString::TagString (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, SetCallback _CB, TagTypes_T _Type)
+    TagString::TagString (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, SetCallback _CB, TagTypes_T _Type)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage, _CB) {
+      ValueType = TagTypes_T::TypeString;
     }
 
-    TagString::TagString (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, TagTypes_T _Type)
+    TagString::TagString (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, TagTypes_T _Type)
         : TagParent (_Name, _Text, _Comment, _ReadOnly, _Value, _Type, _Usage) {
+      ValueType = TagTypes_T::TypeString;
     }
 
     /**
-     * @brief Create the complete Json-String of the Tag-Data
+     * @brief Write the complete Tag-Data into the opened Json-Object
      *
-     * @return String Json-String
+     * @param _Writer Writer with an opened Object
      */
-    String TagString::writeTag () {
-      String SetupTag = writeTagBase ();
-      return SetupTag;
+    void TagString::writeTag (JsonWriter &_Writer) {
+      writeTagBase (_Writer);
     }
 
     /**
@@ -64,6 +65,7 @@ namespace JCA {
      */
     bool TagString::setValue (JsonVariant _Value) {
       *(static_cast<String *> (Value)) = _Value.as<String> ();
+      updateVersion ();
       if (afterSetCB) {
         afterSetCB ();
       }
@@ -2,10 +2,11 @@
  * @file JCA_TAG_TAGString.h
  * @author JCA (https://github.com/ichok)
  * @brief Collection of Tag-Classes to create an Element
- * @version 1.1
+ * @version 1.2
  * @date 2024-04-07
  * @changelog
  * - [1.1] 2025-04-12: Add type to constructor, to override with custom web styles
+ * - [1.2] 2026-10-17: Write the Setup through the JsonWriter
  *
  * Copyright Jochen Cabrera 2024
  * Apache License
@@ -23,10 +24,10 @@ namespace JCA {
       public:
         // Type Informations
 
-        TagString (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, SetCallback _CB, TagTypes_T _Type = TypeString);
-        TagString (String _Name, String _Text, String _Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, TagTypes_T _Type = TypeString);
+        TagString (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, SetCallback _CB, TagTypes_T _Type = TypeString);
+        TagString (const char *_Name, const char *_Text, const char *_Comment, bool _ReadOnly, TagUsage_T _Usage, String *_Value, TagTypes_T _Type = TypeString);
         ~TagString() {;};
-        String writeTag ();
+        void writeTag (JCA::SYS::JsonWriter &_Writer);
         bool getValue (JsonVariant _Value);
         bool setValue (JsonVariant _Value);
         void addValue (JsonObject &_Values);
@@ -27,7 +27,10 @@
 
 // Basics
 #include <JCA_IOT_Server.h>
+#include <JCA_SYS_Arena.h>
+#include <JCA_SYS_StringPool.h>
 #include <JCA_SYS_DebugOut.h>
+#include <JCA_SYS_DocPool.h>
 #include <JCA_SYS_PwmOutput.h>
 #include <JCA_IOT_FuncHandler.h>
 
@@ -60,6 +63,8 @@ using namespace JCA::FNC;
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++
 #define STATE_LED_PIN -1           // disable Status-LED
 //#define STATE_LED_PIN LED_BUILTIN  // set Status to onborad LED
+#define HANDLER_TASK_PERIOD 10     // [ms] Cycle of the FunctionHandler-Task on Core 1 (ESP32 only)
+//#define HANDLER_TASK_PERIOD 0      // update the FunctionHandler inside loop
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // JCA IOT Functions
@@ -120,13 +125,13 @@ void cbSaveConfig () {
 
 void getAllValues (JsonVariant &_Out) {
   JsonObject Elements = _Out[FuncParent::JsonTagElements].to<JsonObject>();
-  Handler.getValues(Elements);
+  Handler.readValues(Elements);
 }
 
 void setAll (JsonVariant &_In) {
   if (_In[FuncParent::JsonTagElements].is<JsonObject>()) {
     JsonObject Elements = _In[FuncParent::JsonTagElements].as<JsonObject>();
-    Handler.setValues(Elements);
+    Handler.writeValues(Elements);
   }
   if (_In["mode"].is<JsonVariant> ()) {
     Handler.patch (_In["mode"].as<String> ());
@@ -154,8 +159,17 @@ void cbRestApiPost (JsonVariant &_In, JsonVariant &_Out) {
 
 void cbRestApiPut (JsonVariant &_In, JsonVariant &_Out) {
   _Out["freeHeap"] = ESP.getFreeHeap ();
+#ifdef ESP8266
+  _Out["maxFreeBlock"] = ESP.getMaxFreeBlockSize ();
+#else
+  _Out["maxFreeBlock"] = ESP.getMaxAllocHeap ();
+#endif
+  _Out["arenaChunks"] = Arena::Objects.getChunkCount ();
+  _Out["poolBytes"] = StringPool::getBytes ();
+  DocPool::Requests.getStats (_Out["docPool"].to<JsonObject> ());
   _Out["functions"] = Handler.getFuncCount();
   _Out["links"] = Handler.getFuncCount ();
+  _Out["commandsRejected"] = Handler.getCommandsRejected ();
 }
 
 void cbRestApiPatch (JsonVariant &_In, JsonVariant &_Out) {
@@ -179,11 +193,48 @@ void cbRestApiDelete (JsonVariant &_In, JsonVariant &_Out) {
   _Out["ret"] = Handler.patch (Mode);
 }
 
+int getHttpCode (FuncAccessRet_T _Ret) {
+  switch (_Ret) {
+  case FuncAccessRet_T::accessDone:
+    return 200;
+  case FuncAccessRet_T::accessQueued:
+    return 202;
+  case FuncAccessRet_T::accessReadOnly:
+    return 403;
+  case FuncAccessRet_T::accessInvalid:
+    return 400;
+  case FuncAccessRet_T::accessQueueFull:
+    return 503;
+  default:
+    return 404;
+  }
+}
+
+int cbRestApiPathGet (const String &_Function, const String &_Tag, JsonVariant &_In, JsonVariant &_Out) {
+  JsonObject Values = _Out.to<JsonObject> ();
+  if (_Tag.length () == 0) {
+    return getHttpCode (Handler.readFunction (_Function.c_str (), Values));
+  }
+  return getHttpCode (Handler.readTag (_Function.c_str (), _Tag.c_str (), Values));
+}
+
+int cbRestApiPathPut (const String &_Function, const String &_Tag, JsonVariant &_In, JsonVariant &_Out) {
+  // The Body is the Value itself, or an Object like the Answer of GET
+  JsonVariant Value = _In[_Tag].isNull () ? _In : _In[_Tag];
+  FuncAccessRet_T Ret = Handler.writeTag (_Function.c_str (), _Tag.c_str (), Value);
+  if (Ret == FuncAccessRet_T::accessQueued) {
+    // Written by the next Cycle, the Answer contains the accepted Value
+    _Out[_Tag] = Value;
+  }
+  return getHttpCode (Ret);
+}
+
 //-------------------------------------------------------
 // Websocket Functions
 //-------------------------------------------------------
 void cbWsUpdate (JsonVariant &_In, JsonVariant &_Out) {
-  getAllValues (_Out);
+  JsonObject Elements = _Out[FuncParent::JsonTagElements].to<JsonObject>();
+  _Out[JCA_IOT_SERVER_WS_SEQUENCE] = Handler.readChangedValues (Elements, _In[JCA_IOT_SERVER_WS_SINCE] | (uint32_t)0, _In[JCA_IOT_SERVER_WS_FUNCTION].as<const char *> (), _In[JCA_IOT_SERVER_WS_TAG].as<const char *> ());
 }
 void cbWsData (JsonVariant &_In, JsonVariant &_Out) {
   setAll (_In);
@@ -242,6 +293,8 @@ void setup () {
   IotServer.onRestApiPut (cbRestApiPut);
   IotServer.onRestApiPatch (cbRestApiPatch);
   IotServer.onRestApiDelete (cbRestApiDelete);
+  IotServer.onRestApiPathGet (cbRestApiPathGet);
+  IotServer.onRestApiPathPut (cbRestApiPathPut);
   Debug.println (FLAG_SETUP, false, "root", __func__, "IotServer-RestAPI Done");
   // Web-Socket
   IotServer.onWsData (cbWsData);
@@ -251,7 +304,12 @@ void setup () {
   // Function-Handler
   addFunctionsToHandler();
   linkHardware();
+  // Changes are pushed by the Server if "wsPush" is set
+  Handler.onChange ([] () { IotServer.notifyChange (); });
   Handler.patch ("init");
+  if (HANDLER_TASK_PERIOD > 0) {
+    Handler.startTask (HANDLER_TASK_PERIOD, [] (tm &_Time) { _Time = IotServer.getLocalTimeStruct (); });
+  }
   Debug.println (FLAG_SETUP, false, "root", __func__, "FunctionHandler Done");
 
   //+++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -265,6 +323,8 @@ void setup () {
 int8_t LastSeconds = 0;
 void loop () {
   IotServer.handle ();
-  tm CurrentTime = IotServer.getLocalTimeStruct ();
-  Handler.update(CurrentTime);
+  if (!Handler.isTaskRunning ()) {
+    tm CurrentTime = IotServer.getLocalTimeStruct ();
+    Handler.update(CurrentTime);
+  }
 }
\ No newline at end of file
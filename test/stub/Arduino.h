@@ -0,0 +1,77 @@
+/**
+ * @file Arduino.h
+ * @author JCA (https://github.com/ichok)
+ * @brief Minimal Arduino-API for the native Tests, only what the tested Libraries use
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#ifndef _JCA_TEST_ARDUINO_
+#define _JCA_TEST_ARDUINO_
+
+#include <chrono>
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define HEX 16
+#define DEC 10
+
+class String : public std::string {
+public:
+  String () {};
+  String (const char *_Text) : std::string (_Text ? _Text : "") {};
+  String (const std::string &_Text) : std::string (_Text) {};
+  String (char _Char) : std::string (1, _Char) {};
+  String (int _Value, int _Base = DEC) : String ((long)_Value, _Base) {};
+  String (unsigned int _Value, int _Base = DEC) : String ((unsigned long)_Value, _Base) {};
+  String (unsigned char _Value, int _Base = DEC) : String ((unsigned long)_Value, _Base) {};
+  String (long _Value, int _Base = DEC) {
+    char Text[24];
+    snprintf (Text, sizeof (Text), _Base == HEX ? "%lx" : "%ld", _Value);
+    assign (Text);
+  };
+  String (unsigned long _Value, int _Base = DEC) {
+    char Text[24];
+    snprintf (Text, sizeof (Text), _Base == HEX ? "%lx" : "%lu", _Value);
+    assign (Text);
+  };
+  unsigned int length () const { return size (); };
+  bool isEmpty () const { return empty (); };
+  char charAt (unsigned int _Index) const { return _Index < size () ? (*this)[_Index] : 0; };
+  bool endsWith (const String &_Suffix) const { return size () >= _Suffix.size () && compare (size () - _Suffix.size (), _Suffix.size (), _Suffix) == 0; };
+  String substring (unsigned int _From) const { return _From < size () ? String (std::string::substr (_From)) : String (); };
+  String substring (unsigned int _From, unsigned int _To) const { return _From < _To && _From < size () ? String (std::string::substr (_From, _To - _From)) : String (); };
+  int indexOf (const char *_Text) const { size_t Pos = find (_Text); return Pos == npos ? -1 : (int)Pos; };
+  void toLowerCase () { for (char &Char : *this) { Char = tolower ((unsigned char)Char); } };
+};
+
+inline String operator+ (const String &_A, const String &_B) { return String (static_cast<const std::string &> (_A) + static_cast<const std::string &> (_B)); }
+inline String operator+ (const String &_A, const char *_B) { return String (static_cast<const std::string &> (_A) + _B); }
+inline String operator+ (const char *_A, const String &_B) { return String (_A + static_cast<const std::string &> (_B)); }
+
+class Print {
+public:
+  virtual ~Print () {};
+  virtual size_t write (uint8_t _Byte) = 0;
+  virtual size_t write (const uint8_t *_Buffer, size_t _Size) {
+    size_t Written = 0;
+    while (_Size-- > 0) {
+      Written += write (*_Buffer++);
+    }
+    return Written;
+  };
+};
+
+inline unsigned long millis () {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+}
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::Crc32 and JCA::SYS::Crc32Combine, the Checksums of the compressed Web-Pages
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Conversion.h>
+#include <string.h>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+static uint8_t Data[1000];
+
+void setUp () {
+  for (size_t i = 0; i < sizeof (Data); i++) {
+    Data[i] = (uint8_t)(i * 31 + (i >> 3));
+  }
+}
+void tearDown () {}
+
+void test_reference () {
+  // Same Values as zlib.crc32 of the Build-Script
+  const char *Check = "123456789";
+  TEST_ASSERT_EQUAL_HEX32 (0x00000000UL, Crc32 (nullptr, 0));
+  TEST_ASSERT_EQUAL_HEX32 (0xCBF43926UL, Crc32 ((const uint8_t *)Check, strlen (Check)));
+  TEST_ASSERT_EQUAL_HEX32 (0x414FA339UL, Crc32 ((const uint8_t *)"The quick brown fox jumps over the lazy dog", 43));
+}
+
+void test_chain () {
+  uint32_t Whole = Crc32 (Data, sizeof (Data));
+  uint32_t Chained = 0;
+  for (size_t i = 0; i < sizeof (Data); i += 77) {
+    size_t Length = (sizeof (Data) - i < 77) ? sizeof (Data) - i : 77;
+    Chained = Crc32 (Data + i, Length, Chained);
+  }
+  TEST_ASSERT_EQUAL_HEX32 (Whole, Chained);
+}
+
+void test_combine () {
+  // Like the Server does with the Segments of a Page, without reading them again
+  const size_t Splits[] = { 0, 1, 2, 3, 8, 255, 256, 511, 999, 1000 };
+  uint32_t Whole = Crc32 (Data, sizeof (Data));
+  for (size_t Split : Splits) {
+    uint32_t First = Crc32 (Data, Split);
+    uint32_t Second = Crc32 (Data + Split, sizeof (Data) - Split);
+    TEST_ASSERT_EQUAL_HEX32 (Whole, Crc32Combine (First, Second, sizeof (Data) - Split));
+  }
+}
+
+void test_combine_segments () {
+  uint32_t Whole = Crc32 (Data, sizeof (Data));
+  uint32_t Combined = 0;
+  for (size_t i = 0; i < sizeof (Data); i += 100) {
+    Combined = Crc32Combine (Combined, Crc32 (Data + i, 100), 100);
+  }
+  TEST_ASSERT_EQUAL_HEX32 (Whole, Combined);
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_reference);
+  RUN_TEST (test_chain);
+  RUN_TEST (test_combine);
+  RUN_TEST (test_combine_segments);
+  return UNITY_END ();
+}
@@ -0,0 +1,166 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::DocArena and JCA::SYS::DocPool
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_DocPool.h>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+void setUp () {}
+void tearDown () {}
+
+void test_arena_allocate () {
+  DocArena Arena;
+  TEST_ASSERT_TRUE (Arena.begin (256));
+  uint8_t *First = (uint8_t *)Arena.allocate (10);
+  uint8_t *Second = (uint8_t *)Arena.allocate (3);
+  TEST_ASSERT_NOT_NULL (First);
+  TEST_ASSERT_NOT_NULL (Second);
+  TEST_ASSERT_EQUAL_size_t (0, (uintptr_t)First % 8);
+  TEST_ASSERT_EQUAL_size_t (0, (uintptr_t)Second % 8);
+  TEST_ASSERT_TRUE (Second >= First + 10);
+  memset (First, 0xAA, 10);
+  memset (Second, 0x55, 3);
+  TEST_ASSERT_EQUAL_UINT8 (0xAA, First[9]);
+  TEST_ASSERT_GREATER_THAN (0, Arena.getMaxUsed ());
+  TEST_ASSERT_EQUAL_UINT32 (0, Arena.getOverflows ());
+}
+
+void test_arena_overflow () {
+  // Blocks that do not fit come from the Heap and are given back to it
+  DocArena Arena;
+  Arena.begin (64);
+  void *Big = Arena.allocate (100);
+  TEST_ASSERT_NOT_NULL (Big);
+  TEST_ASSERT_EQUAL_UINT32 (1, Arena.getOverflows ());
+  memset (Big, 0, 100);
+  Big = Arena.reallocate (Big, 200);
+  TEST_ASSERT_NOT_NULL (Big);
+  Arena.deallocate (Big);
+
+  // Without Buffer every Block is an Overflow
+  DocArena Empty;
+  void *Block = Empty.allocate (8);
+  TEST_ASSERT_NOT_NULL (Block);
+  TEST_ASSERT_EQUAL_UINT32 (1, Empty.getOverflows ());
+  Empty.deallocate (Block);
+}
+
+void test_arena_rewind () {
+  // Only the last Block is given back at once, everything else with reset
+  DocArena Arena;
+  Arena.begin (256);
+  void *First = Arena.allocate (16);
+  void *Second = Arena.allocate (16);
+  Arena.deallocate (Second);
+  TEST_ASSERT_TRUE (Arena.allocate (16) == Second);
+  Arena.deallocate (First);
+  TEST_ASSERT_TRUE (Arena.allocate (16) != First);
+  Arena.reset ();
+  TEST_ASSERT_TRUE (Arena.allocate (16) == First);
+}
+
+void test_arena_reallocate () {
+  DocArena Arena;
+  Arena.begin (256);
+  // The last Block grows in place, like a String of the Deserializer
+  char *Text = (char *)Arena.allocate (4);
+  memcpy (Text, "abc", 4);
+  TEST_ASSERT_TRUE (Arena.reallocate (Text, 64) == Text);
+  TEST_ASSERT_EQUAL_STRING ("abc", Text);
+
+  // A Block in the Middle is copied to the End
+  char *Other = (char *)Arena.allocate (8);
+  TEST_ASSERT_NOT_NULL (Other);
+  char *Moved = (char *)Arena.reallocate (Text, 100);
+  TEST_ASSERT_TRUE (Moved != Text);
+  TEST_ASSERT_EQUAL_UINT32 (0, Arena.getOverflows ());
+  TEST_ASSERT_EQUAL_STRING ("abc", Moved);
+
+  // Shrinking never moves
+  TEST_ASSERT_TRUE (Arena.reallocate (Other, 4) == Other);
+
+  // Growing beyond the Buffer moves to the Heap
+  char *Heap = (char *)Arena.reallocate (Moved, 1000);
+  TEST_ASSERT_NOT_NULL (Heap);
+  TEST_ASSERT_EQUAL_UINT32 (1, Arena.getOverflows ());
+  TEST_ASSERT_EQUAL_STRING ("abc", Heap);
+  Arena.deallocate (Heap);
+}
+
+void test_pool_borrow () {
+  DocPool Pool (2, 512);
+  JsonDocument Stats;
+  {
+    PooledDoc First (Pool);
+    PooledDoc Second (Pool);
+    PooledDoc Third (Pool);
+    TEST_ASSERT_TRUE (&*First != &*Second);
+    TEST_ASSERT_TRUE (&*Third != &*First && &*Third != &*Second);
+    Pool.getStats (Stats.to<JsonObject> ());
+    TEST_ASSERT_EQUAL_UINT32 (2, Stats["inUse"].as<uint32_t> ());
+    TEST_ASSERT_EQUAL_UINT32 (1, Stats["misses"].as<uint32_t> ());
+  }
+  Pool.getStats (Stats.to<JsonObject> ());
+  TEST_ASSERT_EQUAL_UINT32 (0, Stats["inUse"].as<uint32_t> ());
+  TEST_ASSERT_EQUAL_UINT32 (2, Stats["maxInUse"].as<uint32_t> ());
+  TEST_ASSERT_EQUAL_UINT32 (3, Stats["borrows"].as<uint32_t> ());
+}
+
+void test_pool_reuse () {
+  // A given back Document is empty and its Arena starts at the Beginning again,
+  // the Arena is sized for the larger Slots of ArduinoJson on a 64-Bit Host
+  DocPool Pool (1, 8192);
+  JsonDocument *Used;
+  {
+    PooledDoc Doc (Pool);
+    Used = &*Doc;
+    DeserializationError Error = deserializeJson (*Doc, "{\"PID\":{\"Process\":21.5,\"Name\":\"Heating\"}}");
+    TEST_ASSERT_FALSE (Error);
+    TEST_ASSERT_EQUAL_FLOAT (21.5f, (*Doc)["PID"]["Process"].as<float> ());
+    TEST_ASSERT_EQUAL_STRING ("Heating", (*Doc)["PID"]["Name"].as<const char *> ());
+  }
+  PooledDoc Doc (Pool);
+  TEST_ASSERT_TRUE (&*Doc == Used);
+  TEST_ASSERT_TRUE (Doc->isNull ());
+
+  JsonDocument Stats;
+  Pool.getStats (Stats.to<JsonObject> ());
+  TEST_ASSERT_GREATER_THAN (0, Stats["arenaMaxUsed"].as<uint32_t> ());
+  TEST_ASSERT_EQUAL_UINT32 (0, Stats["overflows"].as<uint32_t> ());
+}
+
+void test_pool_move () {
+  // A moved Document is given back once, by the new Owner
+  DocPool Pool (1, 256);
+  JsonDocument Stats;
+  {
+    PooledDoc Doc (Pool);
+    PooledDoc Moved (std::move (Doc));
+    Pool.getStats (Stats.to<JsonObject> ());
+    TEST_ASSERT_EQUAL_UINT32 (1, Stats["inUse"].as<uint32_t> ());
+  }
+  Pool.getStats (Stats.to<JsonObject> ());
+  TEST_ASSERT_EQUAL_UINT32 (0, Stats["inUse"].as<uint32_t> ());
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_arena_allocate);
+  RUN_TEST (test_arena_overflow);
+  RUN_TEST (test_arena_rewind);
+  RUN_TEST (test_arena_reallocate);
+  RUN_TEST (test_pool_borrow);
+  RUN_TEST (test_pool_reuse);
+  RUN_TEST (test_pool_move);
+  return UNITY_END ();
+}
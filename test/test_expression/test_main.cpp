@@ -0,0 +1,96 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of the Compiler and the Stack-Machine of JCA::SYS::Expression
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Expression.h>
+#include <string>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+static Expression Expr;
+static const float Inputs[3] = { 3.0f, 4.0f, -2.5f };
+
+void setUp () {}
+void tearDown () {}
+
+/**
+ * @brief Compile with three Inputs and compare the Result, the Test fails on a Syntax-Error
+ */
+static void check (float _Expected, const char *_Text) {
+  bool Done = Expr.compile (_Text, 3);
+  TEST_ASSERT_TRUE_MESSAGE (Done, Expr.getError ().c_str ());
+  TEST_ASSERT_EQUAL_FLOAT (_Expected, Expr.evaluate (Inputs));
+}
+
+void test_arithmetic () {
+  check (7.0f, "1+2*3");
+  check (9.0f, "(1+2)*3");
+  check (5.5f, "in0*0.5+in1");
+  check (1.0f, "7%3");
+  check (2.5f, "-in2");
+  check (2.0f, "((((1))))+-+-1");
+  check (-1.0f, "1-1-1");
+}
+
+void test_division_by_zero () {
+  check (0.0f, "in0/0");
+  check (0.0f, "in0%0");
+}
+
+void test_compare_and_logic () {
+  check (1.0f, "in0<in1");
+  check (0.0f, "in0>=in1");
+  check (1.0f, "in0==3 && in1!=3");
+  check (1.0f, "0 || in2");
+  check (0.0f, "!in0");
+  check (1.0f, "1+1==2");
+}
+
+void test_functions () {
+  check (3.0f, "min(in0,in1)");
+  check (4.0f, "max(in0,in1)");
+  check (2.5f, "abs(in2)");
+  check (0.0f, "clamp(in2,0,10)");
+  check (4.0f, "if(in0>2,in1,in2)");
+  check (-2.5f, "if(in0>5,in1,in2)");
+}
+
+void test_syntax_errors () {
+  const char *Invalid[] = { "", "1+", "(1", "min(1)", "foo(1)", "in3", "in0 in1", "1..2", "\xC3\xA4+1" };
+  for (const char *Text : Invalid) {
+    TEST_ASSERT_FALSE (Expr.compile (Text, 3));
+    TEST_ASSERT_FALSE (Expr.isValid ());
+    TEST_ASSERT_FALSE (Expr.getError ().isEmpty ());
+    TEST_ASSERT_EQUAL_FLOAT (0.0f, Expr.evaluate (Inputs));
+  }
+}
+
+void test_nesting_limit () {
+  TEST_ASSERT_TRUE (Expr.compile ("((((((((1))))))))+-(-(abs(-1)))", 0));
+
+  // Deep Input must fail instead of overflowing the Stack of the Task
+  std::string Deep = std::string (10000, '(') + "1" + std::string (10000, ')');
+  TEST_ASSERT_FALSE (Expr.compile (Deep.c_str (), 0));
+  std::string Signs = std::string (10000, '-') + "1";
+  TEST_ASSERT_FALSE (Expr.compile (Signs.c_str (), 0));
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_arithmetic);
+  RUN_TEST (test_division_by_zero);
+  RUN_TEST (test_compare_and_logic);
+  RUN_TEST (test_functions);
+  RUN_TEST (test_syntax_errors);
+  RUN_TEST (test_nesting_limit);
+  return UNITY_END ();
+}
@@ -0,0 +1,241 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::JsonWriter and JCA::SYS::JsonParts, the Serializers of the Server
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_JsonParts.h>
+#include <JCA_SYS_JsonWriter.h>
+#include <math.h>
+#include <string>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+/**
+ * @brief Sink that collects everything written by the JsonWriter
+ */
+class Sink_T : public Print {
+public:
+  std::string Text;
+  size_t write (uint8_t _Byte) override {
+    Text += (char)_Byte;
+    return 1;
+  };
+  size_t write (const uint8_t *_Buffer, size_t _Size) override {
+    Text.append ((const char *)_Buffer, _Size);
+    return _Size;
+  };
+};
+
+void setUp () {}
+void tearDown () {}
+
+void test_writer_nesting () {
+  Sink_T Sink;
+  {
+    JsonWriter Writer (Sink);
+    Writer.beginObject ();
+    Writer.member ("name", "PID");
+    Writer.member ("process", 21.5f);
+    Writer.member ("enabled", true);
+    Writer.member ("offset", -3);
+    Writer.member ("cycles", 7U);
+    Writer.key ("list");
+    Writer.beginArray ();
+    Writer.value (1);
+    Writer.beginObject ();
+    Writer.endObject ();
+    Writer.beginArray ();
+    Writer.endArray ();
+    Writer.null ();
+    Writer.endArray ();
+    Writer.key ("empty");
+    Writer.beginObject ();
+    Writer.endObject ();
+    Writer.endObject ();
+  }
+  TEST_ASSERT_EQUAL_STRING ("{\"name\":\"PID\",\"process\":21.5,\"enabled\":true,\"offset\":-3,\"cycles\":7,"
+                            "\"list\":[1,{},[],null],\"empty\":{}}",
+                            Sink.Text.c_str ());
+}
+
+void test_writer_escape () {
+  Sink_T Sink;
+  {
+    JsonWriter Writer (Sink);
+    Writer.beginObject ();
+    Writer.member ("quote\"key", String ("a\"b\\c\nd\re\tf\x01g"));
+    Writer.member ("plain", "");
+    Writer.endObject ();
+  }
+  TEST_ASSERT_EQUAL_STRING ("{\"quote\\\"key\":\"a\\\"b\\\\c\\nd\\re\\tf\\u0001g\",\"plain\":\"\"}", Sink.Text.c_str ());
+}
+
+void test_writer_not_finite () {
+  // JSON has no Infinity or NaN
+  Sink_T Sink;
+  {
+    JsonWriter Writer (Sink);
+    Writer.beginArray ();
+    Writer.value (NAN);
+    Writer.value (INFINITY);
+    Writer.value (-INFINITY);
+    Writer.value (0.1);
+    Writer.endArray ();
+  }
+  TEST_ASSERT_EQUAL_STRING ("[null,null,null,0.1]", Sink.Text.c_str ());
+}
+
+void test_writer_buffer () {
+  // The Sink only gets whole Buffers until the End, getWritten counts the buffered Bytes too
+  Sink_T Sink;
+  std::string Expected = "[";
+  JsonWriter Writer (Sink);
+  Writer.beginArray ();
+  for (int i = 0; i < 100; i++) {
+    Writer.value ("0123456789");
+    Expected += (i > 0) ? ",\"0123456789\"" : "\"0123456789\"";
+  }
+  Writer.endArray ();
+  Expected += "]";
+  TEST_ASSERT_EQUAL_size_t (Expected.length (), Writer.getWritten ());
+  TEST_ASSERT_GREATER_THAN (0, Sink.Text.length ());
+  TEST_ASSERT_EQUAL_size_t (0, Sink.Text.length () % JCA_SYS_JSONWRITER_BUFFER_SIZE);
+  Writer.flush ();
+  TEST_ASSERT_EQUAL_STRING (Expected.c_str (), Sink.Text.c_str ());
+}
+
+/**
+ * @brief Read the Parts in Chunks of different Sizes and compare them to the whole Serialization
+ */
+static void compare (JsonVariantConst _Data, bool _MsgPack) {
+  std::string Expected;
+  if (_MsgPack) {
+    serializeMsgPack (_Data, Expected);
+  } else {
+    serializeJson (_Data, Expected);
+  }
+  const size_t Chunks[] = { 1, 7, 64, 1024 };
+  for (size_t Chunk : Chunks) {
+    JsonParts Parts (_Data, _MsgPack);
+    TEST_ASSERT_EQUAL_size_t (Expected.size (), Parts.measure ());
+    std::string Output;
+    uint8_t Buffer[1024];
+    size_t Length;
+    while ((Length = Parts.read (Buffer, Chunk)) > 0) {
+      TEST_ASSERT_LESS_OR_EQUAL_size_t (Chunk, Length);
+      Output.append ((const char *)Buffer, Length);
+    }
+    TEST_ASSERT_EQUAL_size_t (0, Parts.read (Buffer, Chunk));
+    TEST_ASSERT_EQUAL_size_t (Expected.size (), Output.size ());
+    TEST_ASSERT_TRUE (Output == Expected);
+  }
+}
+
+static void compareBoth (JsonVariantConst _Data) {
+  compare (_Data, false);
+  compare (_Data, true);
+}
+
+void test_parts_object () {
+  JsonDocument Doc;
+  deserializeJson (Doc, "{\"PID\":{\"Process\":21.5,\"Name\":\"Heating\"},\"list\":[1,2,3],\"on\":true,\"none\":null}");
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+void test_parts_large_object () {
+  // More than 15 Members need the 16 Bit Map-Header of MessagePack
+  JsonDocument Doc;
+  for (int i = 0; i < 20; i++) {
+    Doc[std::string ("key") + std::to_string (i)] = i * 1000;
+  }
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+void test_parts_array () {
+  JsonDocument Doc;
+  for (int i = 0; i < 40; i++) {
+    JsonObject Element = Doc.add<JsonObject> ();
+    Element["index"] = i;
+    Element["text"] = "Element";
+  }
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+void test_parts_nested () {
+  // Shape of the REST-Answer: one large nested Object, each Part holds one Member only
+  JsonDocument Doc;
+  JsonObject Elements = Doc["elements"].to<JsonObject> ();
+  for (int f = 0; f < 30; f++) {
+    JsonObject Function = Elements[std::string ("func") + std::to_string (f)].to<JsonObject> ();
+    for (int t = 0; t < 10; t++) {
+      Function[std::string ("tag") + std::to_string (t)] = f * 100 + t;
+    }
+    JsonArray List = Function["list"].to<JsonArray> ();
+    List.add ("Text");
+    List.add<JsonObject> ();
+    List.add<JsonArray> ().add (1);
+  }
+  Doc["used"] = 1234;
+  compareBoth (Doc.as<JsonVariantConst> ());
+
+  const bool Formats[] = { false, true };
+  for (bool MsgPack : Formats) {
+    JsonParts Parts (Doc.as<JsonVariantConst> (), MsgPack);
+    uint8_t Buffer[64];
+    size_t Total = 0;
+    size_t Length;
+    while ((Length = Parts.read (Buffer, sizeof (Buffer))) > 0) {
+      Total += Length;
+    }
+    TEST_ASSERT_GREATER_THAN (10 * sizeof (Buffer), Total);
+    TEST_ASSERT_LESS_OR_EQUAL_size_t (32, Parts.getMaxPending ());
+  }
+}
+
+void test_parts_escaped_keys () {
+  JsonDocument Doc;
+  deserializeJson (Doc, "{\"quote\\\"key\":1,\"line\\nbreak\":\"a\\\\b\",\"unicode\\u0001\":[]}");
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+void test_parts_empty () {
+  JsonDocument Doc;
+  Doc.to<JsonObject> ();
+  compareBoth (Doc.as<JsonVariantConst> ());
+  Doc.to<JsonArray> ();
+  compareBoth (Doc.as<JsonVariantConst> ());
+  Doc.clear ();
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+void test_parts_scalar () {
+  JsonDocument Doc;
+  Doc.set (42);
+  compareBoth (Doc.as<JsonVariantConst> ());
+  Doc.set ("Text with \"Quotes\"");
+  compareBoth (Doc.as<JsonVariantConst> ());
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_writer_nesting);
+  RUN_TEST (test_writer_escape);
+  RUN_TEST (test_writer_not_finite);
+  RUN_TEST (test_writer_buffer);
+  RUN_TEST (test_parts_object);
+  RUN_TEST (test_parts_large_object);
+  RUN_TEST (test_parts_array);
+  RUN_TEST (test_parts_nested);
+  RUN_TEST (test_parts_escaped_keys);
+  RUN_TEST (test_parts_empty);
+  RUN_TEST (test_parts_scalar);
+  return UNITY_END ();
+}
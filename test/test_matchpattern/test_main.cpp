@@ -0,0 +1,73 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::MatchPattern, used by the WebSocket-Subscriptions
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_Conversion.h>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+void setUp () {}
+void tearDown () {}
+
+void test_literal () {
+  TEST_ASSERT_TRUE (MatchPattern ("PID1", "PID1"));
+  TEST_ASSERT_FALSE (MatchPattern ("PID1", "PID12"));
+  TEST_ASSERT_FALSE (MatchPattern ("PID12", "PID1"));
+  TEST_ASSERT_FALSE (MatchPattern ("pid1", "PID1"));
+  TEST_ASSERT_TRUE (MatchPattern ("", ""));
+  TEST_ASSERT_FALSE (MatchPattern ("", "PID1"));
+}
+
+void test_star () {
+  TEST_ASSERT_TRUE (MatchPattern ("*", ""));
+  TEST_ASSERT_TRUE (MatchPattern ("*", "Process"));
+  TEST_ASSERT_TRUE (MatchPattern ("PID*", "PID"));
+  TEST_ASSERT_TRUE (MatchPattern ("PID*", "PID_Heating"));
+  TEST_ASSERT_TRUE (MatchPattern ("*Value", "ProcessValue"));
+  TEST_ASSERT_TRUE (MatchPattern ("P*s*V*", "ProcessValue"));
+  TEST_ASSERT_TRUE (MatchPattern ("**Value**", "ProcessValue"));
+  TEST_ASSERT_FALSE (MatchPattern ("*Value", "ProcessValues"));
+  TEST_ASSERT_FALSE (MatchPattern ("PID*", "Pump"));
+}
+
+void test_star_backtracking () {
+  // The first Candidate for the Rest is not the right one
+  TEST_ASSERT_TRUE (MatchPattern ("*ab", "aaab"));
+  TEST_ASSERT_TRUE (MatchPattern ("a*b*c", "abbbcbc"));
+  TEST_ASSERT_FALSE (MatchPattern ("a*b*c", "abbbcb"));
+}
+
+void test_question_mark () {
+  TEST_ASSERT_TRUE (MatchPattern ("PID?", "PID1"));
+  TEST_ASSERT_FALSE (MatchPattern ("PID?", "PID"));
+  TEST_ASSERT_FALSE (MatchPattern ("PID?", "PID12"));
+  TEST_ASSERT_TRUE (MatchPattern ("?*", "x"));
+  TEST_ASSERT_FALSE (MatchPattern ("?*", ""));
+}
+
+void test_null () {
+  // A missing Pattern matches all Names, a missing Name is empty
+  TEST_ASSERT_TRUE (MatchPattern (nullptr, "PID1"));
+  TEST_ASSERT_TRUE (MatchPattern (nullptr, nullptr));
+  TEST_ASSERT_TRUE (MatchPattern ("*", nullptr));
+  TEST_ASSERT_FALSE (MatchPattern ("PID", nullptr));
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_literal);
+  RUN_TEST (test_star);
+  RUN_TEST (test_star_backtracking);
+  RUN_TEST (test_question_mark);
+  RUN_TEST (test_null);
+  return UNITY_END ();
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::NameIndex
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_NameIndex.h>
+#include <stdio.h>
+#include <unity.h>
+
+using namespace JCA::SYS;
+
+void setUp () {}
+void tearDown () {}
+
+void test_hash_fnv1a () {
+  // Reference-Values of FNV-1a 32 Bit
+  TEST_ASSERT_EQUAL_HEX32 (0x811C9DC5UL, NameIndex::hash (""));
+  TEST_ASSERT_EQUAL_HEX32 (0xE40C292CUL, NameIndex::hash ("a"));
+  TEST_ASSERT_EQUAL_HEX32 (0xBF9CF968UL, NameIndex::hash ("foobar"));
+}
+
+void test_hash_pieces () {
+  // Hashing piece by piece gives the same Value as the whole Text
+  const uint8_t *Text = (const uint8_t *)"foobar";
+  uint32_t Hash = NameIndex::hash (Text, 3);
+  Hash = NameIndex::hash (Text + 3, 3, Hash);
+  TEST_ASSERT_EQUAL_HEX32 (NameIndex::hash ("foobar"), Hash);
+}
+
+void test_find () {
+  static char Names[100][12];
+  NameIndex Index;
+  Index.reserve (100);
+  for (int16_t i = 0; i < 100; i++) {
+    snprintf (Names[i], sizeof (Names[i]), "Tag%d", i);
+    TEST_ASSERT_TRUE (Index.add (Names[i], i));
+  }
+  TEST_ASSERT_EQUAL_UINT (100, Index.getCount ());
+  for (int16_t i = 0; i < 100; i++) {
+    char Name[12];
+    snprintf (Name, sizeof (Name), "Tag%d", i);
+    TEST_ASSERT_EQUAL_INT16 (i, Index.find (Name));
+  }
+  TEST_ASSERT_EQUAL_INT16 (-1, Index.find ("Tag100"));
+  TEST_ASSERT_EQUAL_INT16 (-1, Index.find (""));
+}
+
+void test_duplicate_keeps_first () {
+  NameIndex Index;
+  Index.reserve (2);
+  TEST_ASSERT_TRUE (Index.add ("PID", 0));
+  TEST_ASSERT_FALSE (Index.add ("PID", 1));
+  TEST_ASSERT_EQUAL_INT16 (0, Index.find ("PID"));
+  TEST_ASSERT_EQUAL_UINT (2, Index.getCount ());
+}
+
+void test_empty_and_full () {
+  NameIndex Index;
+  TEST_ASSERT_EQUAL_INT16 (-1, Index.find ("PID"));
+  TEST_ASSERT_FALSE (Index.add ("PID", 0));
+
+  // The Table keeps one free Slot, so every Search ends
+  Index.reserve (2);
+  TEST_ASSERT_TRUE (Index.add ("A", 0));
+  TEST_ASSERT_TRUE (Index.add ("B", 1));
+  TEST_ASSERT_TRUE (Index.add ("C", 2));
+  TEST_ASSERT_FALSE (Index.add ("D", 3));
+  TEST_ASSERT_EQUAL_INT16 (-1, Index.find ("D"));
+
+  Index.clear ();
+  TEST_ASSERT_EQUAL_INT16 (-1, Index.find ("A"));
+  TEST_ASSERT_EQUAL_UINT (0, Index.getCount ());
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_hash_fnv1a);
+  RUN_TEST (test_hash_pieces);
+  RUN_TEST (test_find);
+  RUN_TEST (test_duplicate_keeps_first);
+  RUN_TEST (test_empty_and_full);
+  return UNITY_END ();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_main.cpp
+ * @author JCA (https://github.com/ichok)
+ * @brief Native Tests of JCA::SYS::RingQueue, the Command-Queue of the Function-Handler
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * Copyright Jochen Cabrera 2026
+ * Apache License
+ *
+ */
+
+#include <JCA_SYS_RingQueue.h>
+#include <thread>
+#include <unity.h>
+#include <vector>
+
+using namespace JCA::SYS;
+
+void setUp () {}
+void tearDown () {}
+
+void test_fifo () {
+  RingQueue<uint32_t, 8> Queue;
+  uint32_t Value;
+  TEST_ASSERT_FALSE (Queue.pop (Value));
+  for (uint32_t i = 0; i < 5; i++) {
+    TEST_ASSERT_TRUE (Queue.push (i));
+  }
+  for (uint32_t i = 0; i < 5; i++) {
+    TEST_ASSERT_TRUE (Queue.pop (Value));
+    TEST_ASSERT_EQUAL_UINT32 (i, Value);
+  }
+  TEST_ASSERT_FALSE (Queue.pop (Value));
+}
+
+void test_full () {
+  RingQueue<uint32_t, 4> Queue;
+  uint32_t Value;
+  for (uint32_t i = 0; i < Queue.capacity (); i++) {
+    TEST_ASSERT_TRUE (Queue.push (i));
+  }
+  TEST_ASSERT_FALSE (Queue.push (99));
+  TEST_ASSERT_FALSE (Queue.push (99));
+  TEST_ASSERT_EQUAL_UINT32 (2, Queue.getDropped ());
+
+  // A Cell is free again after pop
+  TEST_ASSERT_TRUE (Queue.pop (Value));
+  TEST_ASSERT_EQUAL_UINT32 (0, Value);
+  TEST_ASSERT_TRUE (Queue.push (4));
+  for (uint32_t i = 1; i <= 4; i++) {
+    TEST_ASSERT_TRUE (Queue.pop (Value));
+    TEST_ASSERT_EQUAL_UINT32 (i, Value);
+  }
+}
+
+void test_wrap_around () {
+  // Many Rounds over the Cells, the Sequences keep counting
+  RingQueue<uint32_t, 4> Queue;
+  uint32_t Value;
+  for (uint32_t i = 0; i < 1000; i++) {
+    TEST_ASSERT_TRUE (Queue.push (i));
+    TEST_ASSERT_TRUE (Queue.push (i + 1000000));
+    TEST_ASSERT_TRUE (Queue.pop (Value));
+    TEST_ASSERT_EQUAL_UINT32 (i, Value);
+    TEST_ASSERT_TRUE (Queue.pop (Value));
+    TEST_ASSERT_EQUAL_UINT32 (i + 1000000, Value);
+  }
+  TEST_ASSERT_EQUAL_UINT32 (0, Queue.getDropped ());
+}
+
+void test_producers () {
+  // Several Producers and one Consumer: nothing is lost or doubled and each Producer keeps its Order
+  static RingQueue<uint32_t, 64> Queue;
+  const uint32_t Producers = 4;
+  const uint32_t Count = 20000;
+  std::vector<std::thread> Threads;
+  for (uint32_t p = 0; p < Producers; p++) {
+    Threads.emplace_back ([p] () {
+      for (uint32_t i = 0; i < Count; i++) {
+        while (!Queue.push ((p << 24) | i)) {
+          std::this_thread::yield ();
+        }
+      }
+    });
+  }
+  std::vector<uint32_t> Next (Producers, 0);
+  uint32_t Received = 0;
+  bool Ordered = true;
+  while (Received < Producers * Count) {
+    uint32_t Value;
+    if (!Queue.pop (Value)) {
+      std::this_thread::yield ();
+      continue;
+    }
+    uint32_t Producer = Value >> 24;
+    if (Producer >= Producers || (Value & 0xFFFFFF) != Next[Producer]) {
+      Ordered = false;
+    } else {
+      Next[Producer]++;
+    }
+    Received++;
+  }
+  for (std::thread &Thread : Threads) {
+    Thread.join ();
+  }
+  TEST_ASSERT_TRUE (Ordered);
+  for (uint32_t p = 0; p < Producers; p++) {
+    TEST_ASSERT_EQUAL_UINT32 (Count, Next[p]);
+  }
+  uint32_t Value;
+  TEST_ASSERT_FALSE (Queue.pop (Value));
+}
+
+int main (int argc, char **argv) {
+  UNITY_BEGIN ();
+  RUN_TEST (test_fifo);
+  RUN_TEST (test_full);
+  RUN_TEST (test_wrap_around);
+  RUN_TEST (test_producers);
+  return UNITY_END ();
+}